@@ -150,19 +150,19 @@ end
 function counter_init(max)
 	local new_value
 
-	new_value = field.counter + power;
+	new_value = field_counter(field) + power;
 
 	-- Bounds checking
 	if new_value > max then
-		field.counter = max
+		field_set_counter(field, max)
 		
 	elseif new_value < 0 then
 		-- Hack - we'll decrement next turn
-		field.counter = 1
+		field_set_counter(field, 1)
 		
 	else
 		-- Store in the new value
-		field.counter = new_value
+		field_set_counter(field, new_value)
 	end
 end
 
@@ -37,6 +37,7 @@
 #include "z-virt.h"
 #include "z-form.h"
 #include "z-rand.h"
+#include "z-pack.h"
 #include "z-term.h"
 
 /*
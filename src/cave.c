@@ -2708,6 +2708,11 @@ void update_mon_lite(void)
 				/* It is now unlit */
 				note_spot(fx, fy);
 			}
+			else
+			{
+				/* Redraw it later */
+				queue_spot(fx, fy);
+			}
 		}
 	}
 
@@ -2729,6 +2734,9 @@ void update_mon_lite(void)
 		{
 			/* Clear the temp flag for the old lit grids that are still lit */
 			c_ptr->info &= ~(CAVE_TEMP);
+
+			/* Its "seen" flag may have changed */
+			queue_spot(fx, fy);
 		}
 
 		/* Is the square newly lit and visible? */
@@ -2744,6 +2752,11 @@ void update_mon_lite(void)
 			/* It is now lit */
 			note_spot(fx, fy);
 		}
+		else
+		{
+			/* Redraw it later */
+			queue_spot(fx, fy);
+		}
 
 		/* Save in the monster lit array */
 		lite_x[lite_n] = fx;
@@ -3247,15 +3260,15 @@ void cave_set_feat(int x, int y, int feat)
 		}
 	}
 
-	/* Redraw map */
-	p_ptr->redraw |= (PR_MAP);
-
 	/* Window stuff */
 	p_ptr->window |= (PW_OVERHEAD | PW_DUNGEON);
 
 	/* Change the feature */
 	c_ptr->feat = feat;
 
+	/* Redraw the grid */
+	queue_spot(x, y);
+
 	/* Notice + Redraw */
 	if (character_dungeon) note_spot(x, y);
 
@@ -1071,6 +1071,47 @@ static bool do_cmd_options_delay(int dummy)
 	return (FALSE);
 }
 
+/*
+ * Modify the subwindow delay factor
+ */
+static bool do_cmd_options_window_delay(int dummy)
+{
+	char k;
+	
+	/* Hack - ignore parameter */
+	(void) dummy;
+	
+	screen_save();
+
+	/* Clear screen */
+	Term_clear();
+
+	/* Prompt */
+	prtf(0, 18, "Command: Subwindow Delay Factor");
+
+	/* Get a new value */
+	while (1)
+	{
+		int msec = window_delay * window_delay * window_delay;
+		prtf(0, 22, "Current subwindow delay factor: %d (%d msec)",
+				   window_delay, msec);
+		prtf(0, 23, "Subwindow redraws saved: %lu", (unsigned long)window_saved);
+		prtf(0, 20, "Delay Factor (0-9 or ESC to accept): ");
+
+		k = inkey();
+
+		if (k == ESCAPE) break;
+		if (isdigit(k)) window_delay = D2I(k);
+		else
+			bell("Illegal delay factor!");
+	}
+
+	screen_load();
+
+
+	return (FALSE);
+}
+
 /*
  * Modify the hitpoint warning threshold
  */
@@ -1160,7 +1201,7 @@ static bool do_cmd_options_dump(int dummy)
 }
 
 /* Number of things in the main options menu */
-#define OPTION_MENU_MAX			18
+#define OPTION_MENU_MAX			19
 
 
 /* The main options menu */
@@ -1177,6 +1218,7 @@ static menu_type options_menu[OPTION_MENU_MAX] =
 	MENU_SEPERATOR,
 	{"Cheating Options", NULL, do_cmd_options_cheat, MN_ACTIVE | MN_SELECT | MN_CLEAR},
 	{"Base Delay Factor", NULL, do_cmd_options_delay, MN_ACTIVE | MN_SELECT},
+	{"Subwindow Delay Factor", NULL, do_cmd_options_window_delay, MN_ACTIVE | MN_SELECT},
 	{"Hitpoint Warning", NULL, do_cmd_options_hitpoint, MN_ACTIVE | MN_SELECT},
 	MENU_SEPERATOR,
 	{"Autosave Options", NULL, do_cmd_options_autosave, MN_ACTIVE | MN_SELECT | MN_CLEAR},
@@ -2470,6 +2512,9 @@ static bool do_cmd_change_feature(int dummy)
 		if (i == 'A') f_info[f].x_attr = (byte)(ca - 1);
 		if (i == 'c') f_info[f].x_char = (byte)(cc + 1);
 		if (i == 'C') f_info[f].x_char = (byte)(cc - 1);
+
+		/* The cached terrain glyphs may be wrong */
+		reset_glyph_cache();
 	}
 
 	screen_load();
@@ -32,7 +32,13 @@
 #define VERSION_NAME "ZAngband"
 
 /* Savefile version */
-#define SAVEFILE_VERSION 52
+#define SAVEFILE_VERSION 53
+
+/* Savefile version written when the map sections are not packed */
+#define SAVEFILE_VERSION_UNPACKED 52
+
+/* Number of byte "planes" in the packed wilderness savefile section */
+#define WILD_SECTION_PLANES	6
 
 /* User-visible version */
 #define VER_MAJOR 2
@@ -1823,6 +1829,24 @@
 #define TV_BOOKS_MIN    TV_LIFE_BOOK	/* First tval of spellbooks */
 #define TV_BOOKS_MAX    TV_ARCANE_BOOK	/* Last tval of spellbooks */
 
+/*
+ * Groups of "tvals", as used by the item tester hooks
+ */
+#define TVG_WEAPON			0x0001	/* Weapons, bows and ammo */
+#define TVG_MELEE			0x0002	/* Melee weapons */
+#define TVG_NONSWORD		0x0004	/* Hafted weapons and polearms */
+#define TVG_AMMO			0x0008	/* Shots, arrows and bolts */
+#define TVG_FLETCHER		0x0010	/* Ammo and bows */
+#define TVG_ARMOUR			0x0020	/* Armour */
+#define TVG_SOFT_ARMOUR		0x0040	/* Soft armour */
+#define TVG_HARD_ARMOUR		0x0080	/* Hard armour */
+#define TVG_HELM			0x0100	/* Helms and crowns */
+#define TVG_PURE_HARD		0x0200	/* Hard body armour */
+#define TVG_WEAPON_ARMOUR	0x0400	/* Weapons and armour, but not ammo */
+#define TVG_RECHARGE		0x0800	/* Rechargable devices */
+#define TVG_JEWEL			0x1000	/* Rings and amulets */
+#define TVG_BOOK			0x2000	/* Spellbooks */
+
 /* Any subvalue */
 #define SV_ANY 					255
 
@@ -2624,7 +2648,7 @@
 #define PR_STATE        0x00100000L	/* Display Extra (State) */
 #define PR_SPEED        0x00200000L	/* Display Extra (Speed) */
 #define PR_STUDY        0x00400000L	/* Display Extra (Study) */
-/* xxx */
+#define PR_MAP_SPOTS    0x00800000L	/* Display changed map grids */
 #define PR_EXTRA        0x01000000L	/* Display Extra Info */
 #define PR_BASIC        0x02000000L	/* Display Basic Info */
 #define PR_MAP          0x04000000L	/* Display Map */
@@ -4167,7 +4191,7 @@ static __inline void COPY_FLAG_AUX(const u32b *flags1, u32b *flags2, int num, u3
 /* {TRUE,  0, NULL,					"Number 51" }, p_ptr->options[36] */
 #define flush_failure			p_ptr->options[37]
 #define flush_disturb			p_ptr->options[38]
-/* {FALSE, 0, NULL, 					"Number 54" }, p_ptr->options[39] */
+#define pack_savefile			p_ptr->options[39]
 #define fresh_before			p_ptr->options[40]
 #define fresh_after				p_ptr->options[41]
 #define emergency_stop			p_ptr->options[42]
@@ -5005,6 +5029,19 @@ extern int PlayerUID;
 #define FIELD_INFO_DUMMY13	0x4000
 #define FIELD_INFO_DUMMY14  0x8000
 
+/*
+ * The field flags that are summarised in each grid.
+ *
+ * These do not change once a field is made (unlike VIS, MARK
+ * and NO_LOOK which are changed by detection and memory, and
+ * NFT_LOOK which the door scripts set when a door is used).
+ */
+#define FIELD_INFO_GRID \
+	(FIELD_INFO_TEMP | FIELD_INFO_FEAT | FIELD_INFO_TRANS | \
+	 FIELD_INFO_MERGE | FIELD_INFO_NO_ENTER | \
+	 FIELD_INFO_NO_MAGIC | FIELD_INFO_NO_OBJCT | FIELD_INFO_PERM | \
+	 FIELD_INFO_IGNORE | FIELD_INFO_NO_MPLACE)
+
 #define FTYPE_NOTHING	0
 #define FTYPE_TRAP		1
 #define FTYPE_DOOR		2
@@ -5015,6 +5052,12 @@ extern int PlayerUID;
 #define FTYPE_CORPSE	7
 #define FTYPE_MISC		8
 
+/*
+ * The bit for a field type in cave_type.fld_type
+ */
+#define FTYPE_FLAG(T) \
+	((u16b)(1 << (T)))
+
 /*
  * Field Actions
  */
@@ -930,6 +930,13 @@ static void process_world(void)
 	/* Every 10 game turns */
 	if (turn % 10) return;
 
+	/*** Notice finished background autosaves ***/
+	if (save_player_background_check(FALSE))
+	{
+		/* Save the one that had to wait */
+		do_cmd_save_game(TRUE);
+	}
+
 	/*** Attempt timed autosave ***/
 	if (autosave_t && autosave_freq)
 	{
@@ -3020,22 +3027,22 @@ static void evolve_dungeon(void)
 		/* Hack -- Compact the monster list occasionally */
 		if (m_cnt + 32 > z_info->m_max) compact_monsters(64);
 
-		/* Hack -- Compress the monster list occasionally */
-		if (m_cnt + 32 < m_max) compact_monsters(0);
+		/* Hack -- Compress the monster list when it is mostly holes */
+		if (m_cnt * 2 + 64 < m_max) compact_monsters(0);
 
 
 		/* Hack -- Compact the object list occasionally */
 		if (o_cnt + 32 > z_info->o_max) compact_objects(64);
 
-		/* Hack -- Compress the object list occasionally */
-		if (o_cnt + 32 < o_max) compact_objects(0);
+		/* Hack -- Compress the object list when it is mostly holes */
+		if (o_cnt * 2 + 64 < o_max) compact_objects(0);
 
 
 		/* Hack -- Compact the field list occasionally */
 		if (fld_cnt + 32 > z_info->fld_max) compact_fields(64);
 
-		/* Hack -- Compress the field list occasionally */
-		if (fld_cnt + 32 < fld_max) compact_fields(0);
+		/* Hack -- Compress the field list when it is mostly holes */
+		if (fld_cnt * 2 + 64 < fld_max) compact_fields(0);
 
 		/*
 		 * Add energy to player and monsters.
@@ -3053,7 +3060,13 @@ static void evolve_dungeon(void)
 		move_cursor_relative(p_ptr->px, p_ptr->py);
 
 		/* Optional fresh */
-		if (fresh_after) Term_fresh();
+		if (fresh_after)
+		{
+			/* Catch up on the subwindows */
+			frame_stuff();
+
+			Term_fresh();
+		}
 
 		/* Hack -- Notice death or departure */
 		if (!p_ptr->state.playing || p_ptr->state.is_dead) break;
@@ -3074,7 +3087,13 @@ static void evolve_dungeon(void)
 		move_cursor_relative(p_ptr->px, p_ptr->py);
 
 		/* Optional fresh */
-		if (fresh_after) Term_fresh();
+		if (fresh_after)
+		{
+			/* Catch up on the subwindows */
+			frame_stuff();
+
+			Term_fresh();
+		}
 
 		/* Hack -- Notice death or departure */
 		if (!p_ptr->state.playing || p_ptr->state.is_dead) break;
@@ -3101,7 +3120,13 @@ static void evolve_dungeon(void)
 		move_cursor_relative(p_ptr->px, p_ptr->py);
 
 		/* Optional fresh */
-		if (fresh_after) Term_fresh();
+		if (fresh_after)
+		{
+			/* Catch up on the subwindows */
+			frame_stuff();
+
+			Term_fresh();
+		}
 
 		/* Hack -- Notice death or departure */
 		if (!p_ptr->state.playing || p_ptr->state.is_dead) break;
@@ -3206,19 +3231,24 @@ void play_game(bool new_game)
 	 * Initialize wilderness info
 	 * This needs to be done before old savefiles are loaded.
 	 */
+	startup_phase("w_info");
 	if (init_w_info()) quit("Cannot initialize wilderness");
 
 	/* Initialize field info */
+	startup_phase("t_info");
 	if (init_t_info()) quit("Cannot initialize fields");
 
 
 	/* Attempt to load */
+	startup_phase("savefile");
 	if (!load_player())
 	{
 		/* Oops */
 		quit("broken savefile");
 	}
 
+	startup_phase(NULL);
+
 	/* Nothing loaded */
 	if (!character_loaded)
 	{
@@ -3289,7 +3319,9 @@ void play_game(bool new_game)
 		}
 		
 		/* Create a new wilderness for the player */
+		startup_phase("wilderness");
 		create_wilderness();
+		startup_phase(NULL);
 
 		/* The dungeon is ready */
 		character_dungeon = TRUE;
@@ -3333,7 +3365,9 @@ void play_game(bool new_game)
 	flavor_init();
 
 	/* Load the "pref" files */
+	startup_phase("user_prefs");
 	load_all_pref_files();
+	startup_phase(NULL);
 
 	/*
 	 * Set or clear "rogue_like_commands" if requested
@@ -3344,6 +3378,7 @@ void play_game(bool new_game)
 	if (arg_force_roguelike) rogue_like_commands = TRUE;
 
 	/* Generate a dungeon level if needed */
+	startup_phase("level");
 	if (!character_dungeon) generate_cave();
 
 	/* Character is now "complete" */
@@ -3379,6 +3414,9 @@ void play_game(bool new_game)
 	/* Leave "xtra" mode */
 	character_xtra = FALSE;
 
+	/* The start up is over, so report on it if asked */
+	if (arg_profile) quit(startup_report());
+
 	/* Window stuff */
 	p_ptr->window |= (PW_INVEN | PW_EQUIP | PW_SPELL | PW_PLAYER);
 
@@ -100,6 +100,10 @@ extern bool arg_bigtile;
 extern bool arg_monochrome;
 extern bool arg_force_original;
 extern bool arg_force_roguelike;
+extern bool arg_profile;
+extern cptr arg_profile_json;
+extern cptr arg_profile_budget;
+extern huge file_bytes_read;
 extern bool character_generated;
 extern bool character_dungeon;
 extern bool character_loaded;
@@ -118,11 +122,14 @@ extern bool use_transparency;
 extern s16b signal_count;
 extern s16b o_max;
 extern s16b o_cnt;
+extern u32b o_compacted;
 extern s16b m_max;
 extern s16b m_cnt;
+extern u32b m_compacted;
 extern s16b q_max;
 extern s16b fld_max;
 extern s16b fld_cnt;
+extern u32b fld_compacted;
 extern s16b rg_max;
 extern s16b rg_cnt;
 extern s16b hack_m_idx;
@@ -136,6 +143,8 @@ extern bool track_follow;
 extern bool track_target;
 extern byte hitpoint_warn;
 extern byte delay_factor;
+extern byte window_delay;
+extern u32b window_saved;
 extern s16b autosave_freq;
 extern byte autosave_t;
 extern byte autosave_l;
@@ -203,8 +212,11 @@ extern u16b place_count;
 extern place_type *place;
 extern s16b alloc_kind_size;
 extern alloc_entry *alloc_kind_table;
+extern s32b *alloc_kind_cum;
 extern s16b alloc_race_size;
 extern alloc_entry *alloc_race_table;
+extern s32b *alloc_race_cum;
+extern s16b *alloc_race_check;
 extern s16b alloc_ego_size;
 extern alloc_entry *alloc_ego_table;
 extern byte misc_to_attr[256];
@@ -438,6 +450,7 @@ extern void incref_region(int rg_idx);
 extern void set_region(int rg_idx);
 extern void wipe_rg_list(void);
 extern void create_region_aux(s16b *region, int x, int y, byte flags);
+extern void wipe_region_pool(void);
 extern void generate_cave(void);
 
 /* init1.c */
@@ -451,6 +464,9 @@ extern void init_file_paths(char *path);
 extern void init_angband(void);
 extern void cleanup_angband(void);
 extern errr check_modification_date(int fd, cptr template_file);
+extern void startup_phase(cptr name);
+extern void startup_dump(void);
+extern cptr startup_report(void);
 
 /* load.c */
 extern errr rd_savefile_new(void);
@@ -481,10 +497,14 @@ extern cptr funny_comments[MAX_SAN_COMMENT];
 extern void delete_monster_idx(int i);
 extern void delete_monster(int x, int y);
 extern void compact_monsters(int size);
+extern void m_free_rebuild(void);
 extern void wipe_m_list(void);
 extern void wipe_monsters(int rg_idx);
 extern s16b m_pop(void);
+extern void get_mon_num_prep_forget(void);
+extern void get_mon_num_prep_key(monster_hook_type monster_hook, u32b key);
 extern void get_mon_num_prep(monster_hook_type monster_hook);
+extern void get_mon_num_forget(void);
 extern s16b get_mon_num(int level);
 extern s16b get_filter_mon_num(int level, monster_hook_type monster_hook);
 extern void monster_desc(char *desc, const monster_type *m_ptr, int mode,
@@ -524,6 +544,7 @@ extern void change_repair(void);
 /* flavor.c */
 extern void get_table_name(char *out_string, bool quotes);
 extern void flavor_init(void);
+extern void object_desc_forget(void);
 extern void object_desc(char *buf, const object_type *o_ptr, int pref,
 						int mode, int size);
 extern void object_fmt(char *buf, uint max, cptr fmt, va_list *vp);
@@ -555,6 +576,7 @@ extern bool item_tester_hook_weapon_armour(const object_type *o_ptr);
 extern bool item_tester_hook_wear(const object_type *o_ptr);
 extern bool item_tester_hook_recharge(const object_type *o_ptr);
 extern bool item_tester_hook_jewel(const object_type *o_ptr);
+extern u16b tval_groups(byte tval);
 extern bool item_tester_hook_tval(const object_type *o_ptr, byte tval);
 extern bool item_tester_hook_is_blessed(const object_type *o_ptr);
 extern bool item_tester_hook_is_good(const object_type *o_ptr);
@@ -573,12 +595,16 @@ extern void delete_object(int x, int y);
 extern void delete_object_list(s16b *o_idx_ptr);
 extern void drop_object_list(s16b *o_idx_ptr, int x, int y);
 extern void compact_objects(int size);
+extern void o_free_rebuild(void);
 extern void wipe_o_list(void);
 extern void wipe_objects(int rg_idx);
 extern object_type *add_object_list(s16b *o_idx_ptr, object_type *o_ptr);
 extern void move_object(s16b *tgt_list_ptr, s16b *cur_list_ptr,
 						object_type *o_ptr);
 extern void swap_objects(object_type *o1_ptr, object_type *o2_ptr);
+extern int alloc_level_index(const alloc_entry *table, int size, int level);
+extern int alloc_prob_index(const s32b *cum, int lo, int hi, s32b value);
+extern void get_obj_num_prep_forget(void);
 extern void get_obj_num_prep(object_hook_type object_hook);
 extern s16b get_obj_num(int level, int min_level);
 extern void object_known(object_type *o_ptr);
@@ -647,6 +673,8 @@ extern void do_cmd_racial_power(void);
 
 /* save.c */
 extern bool save_player(void);
+extern bool save_player_background(void);
+extern bool save_player_background_check(bool wait);
 extern bool load_player(void);
 
 /* spells1.c */
@@ -848,6 +876,7 @@ extern void init_setuid(void);
 extern void signals_ignore_tstp(void);
 extern void signals_handle_tstp(void);
 extern void signals_init(void);
+extern u32b time_usec(void);
 extern bool assert_helper(cptr expr, cptr file, int line, bool result);
 extern errr path_parse(char *buf, int max, cptr file);
 extern void path_build(char *buf, int max, cptr path, cptr file);
@@ -911,6 +940,7 @@ extern void update_stuff(void);
 extern void redraw_stuff(void);
 extern void window_stuff(void);
 extern void handle_stuff(void);
+extern void frame_stuff(void);
 extern void change_stuff(void);
 bool player_save(int power);
 extern void object_bonuses(const object_type *o_ptr, bonuses_type *b);
@@ -1111,9 +1141,12 @@ extern void delete_field_ptr(field_type *f_ptr);
 extern void delete_field(int x, int y);
 extern void delete_field_location(cave_type *c_ptr);
 extern void compact_fields(int size);
+extern void f_free_rebuild(void);
 extern void wipe_f_list(void);
 extern void wipe_fields(int rg_idx);
 extern s16b f_pop(void);
+extern s16b field_counter(const field_type *f_ptr);
+extern void field_set_counter(field_type *f_ptr, s16b counter);
 extern void field_wipe(field_type *f_ptr);
 extern void field_copy(field_type *f_ptr, field_type *j_ptr);
 extern s16b field_add(field_type *f_ptr, cave_type *c_ptr);
@@ -1173,6 +1206,12 @@ extern void free_term_callbacks(void);
 extern void init_overhead_map(void);
 extern void del_overhead_map(void);
 extern void display_dungeon(void);
+extern u32b map_full_redraws;
+extern u32b map_spot_redraws;
+extern u32b map_grids_redrawn;
+extern void reset_glyph_cache(void);
+extern void queue_spot(int x, int y);
+extern void prt_map_spots(void);
 extern void lite_spot(int x, int y);
 extern void prt_map(void);
 extern void display_map(int *cx, int *cy);
@@ -56,6 +56,253 @@ cptr field_name(const field_type *f_ptr)
 	return (t_info[f_ptr->t_idx].name);
 }
 
+/*
+ * The dead entries in the field list.
+ *
+ * A stack of the indexes of wiped fields, so that f_pop() does not
+ * have to search the list for a hole.  Stale entries are skipped when
+ * they are popped, and the stack is rebuilt by compact_fields(), by
+ * rd_dungeon() and by f_pop() before it gives up.
+ */
+static s16b *fld_free = NULL;
+static s16b fld_free_num = 0;
+
+
+/*
+ * Put a (wiped) field on the free stack
+ */
+static void f_push(field_type *f_ptr)
+{
+	int fld_idx = GET_ARRAY_INDEX(fld_list, f_ptr);
+
+	/* Paranoia - only fields in the list */
+	if ((fld_idx < 1) || (fld_idx >= fld_max)) return;
+
+	/* Make the stack */
+	if (!fld_free) C_MAKE(fld_free, z_info->fld_max, s16b);
+
+	/* Paranoia - a full stack only loses the hole until the next rebuild */
+	if (fld_free_num >= z_info->fld_max) return;
+
+	fld_free[fld_free_num++] = fld_idx;
+}
+
+
+/*
+ * Rebuild the free stack from the field list
+ */
+void f_free_rebuild(void)
+{
+	int i;
+
+	/* Make the stack */
+	if (!fld_free) C_MAKE(fld_free, z_info->fld_max, s16b);
+
+	fld_free_num = 0;
+
+	/* Push the highest holes first, so the lowest are used first */
+	for (i = fld_max - 1; i >= 1; i--)
+	{
+		if (!fld_list[i].t_idx) fld_free[fld_free_num++] = i;
+	}
+}
+
+
+/*
+ * The timer wheel for temporary fields.
+ *
+ * A temporary field counts down once every ten game turns, and calls
+ * its FIELD_ACT_EXIT script when it gets to zero.  Rather than look at
+ * every field each time, the fields are kept in lists by the "tick"
+ * they run out on, so only the fields that are due are looked at.
+ *
+ * There are two levels.  The first has a list for each of the next
+ * FLD_WHEEL_SIZE ticks, and the second has a list for each block of
+ * FLD_WHEEL_SIZE ticks after that.  When a block starts, its list is
+ * spread out over the first level.
+ *
+ * The counter of a field on the wheel is not kept up to date, so
+ * use field_counter() and field_set_counter() to get at it.
+ */
+#define FLD_WHEEL_BITS	8
+#define FLD_WHEEL_SIZE	(1 << FLD_WHEEL_BITS)
+#define FLD_WHEEL_MASK	(FLD_WHEEL_SIZE - 1)
+
+typedef struct field_timer field_timer;
+
+struct field_timer
+{
+	s32b due;	/* Tick the field runs out on (0 = not on the wheel) */
+
+	s16b slot;	/* List the field is in */
+
+	s16b next;	/* Next field in the list */
+	s16b prev;	/* Previous field in the list */
+};
+
+static field_timer *fld_timer = NULL;
+
+static s16b fld_wheel[FLD_WHEEL_SIZE * 2];
+
+/* Number of ticks so far */
+static s32b fld_tick = 0;
+
+
+/*
+ * Get the index of a field in the field list.
+ *
+ * Returns zero for fields that are not in the list.
+ */
+static int field_list_idx(const field_type *f_ptr)
+{
+	if ((f_ptr <= fld_list) || (f_ptr >= fld_list + fld_max)) return (0);
+
+	return (GET_ARRAY_INDEX(fld_list, f_ptr));
+}
+
+
+/*
+ * Put a field on the timer wheel
+ */
+static void field_timer_link(int fld_idx, s32b due)
+{
+	field_timer *ft_ptr = &fld_timer[fld_idx];
+
+	int slot;
+
+	/* Soon - use the first level */
+	if (due - fld_tick < FLD_WHEEL_SIZE)
+	{
+		slot = due & FLD_WHEEL_MASK;
+	}
+
+	/* Later - use the second level */
+	else
+	{
+		slot = FLD_WHEEL_SIZE + ((due >> FLD_WHEEL_BITS) & FLD_WHEEL_MASK);
+	}
+
+	ft_ptr->due = due;
+	ft_ptr->slot = slot;
+
+	/* Add to the front of the list */
+	ft_ptr->prev = 0;
+	ft_ptr->next = fld_wheel[slot];
+
+	if (ft_ptr->next) fld_timer[ft_ptr->next].prev = fld_idx;
+
+	fld_wheel[slot] = fld_idx;
+}
+
+
+/*
+ * Take a field off the timer wheel
+ */
+static void field_timer_unlink(int fld_idx)
+{
+	field_timer *ft_ptr = &fld_timer[fld_idx];
+
+	/* Not on the wheel */
+	if (!ft_ptr->due) return;
+
+	if (ft_ptr->prev)
+	{
+		fld_timer[ft_ptr->prev].next = ft_ptr->next;
+	}
+	else
+	{
+		fld_wheel[ft_ptr->slot] = ft_ptr->next;
+	}
+
+	if (ft_ptr->next) fld_timer[ft_ptr->next].prev = ft_ptr->prev;
+
+	ft_ptr->due = 0;
+}
+
+
+/*
+ * Put a field on the timer wheel (or take it off) to match its counter
+ */
+static void field_timer_set(field_type *f_ptr)
+{
+	int fld_idx = field_list_idx(f_ptr);
+
+	/* Only fields in the list */
+	if (!fld_idx) return;
+
+	/* Make the wheel */
+	if (!fld_timer) C_MAKE(fld_timer, z_info->fld_max, field_timer);
+
+	field_timer_unlink(fld_idx);
+
+	/* Only temporary fields that have not run out yet */
+	if (!(f_ptr->info & FIELD_INFO_TEMP) || (f_ptr->counter <= 0)) return;
+
+	field_timer_link(fld_idx, fld_tick + f_ptr->counter);
+}
+
+
+/*
+ * Take a field off the timer wheel, if it is on it
+ */
+static void field_timer_forget(const field_type *f_ptr)
+{
+	int fld_idx = field_list_idx(f_ptr);
+
+	if (fld_idx && fld_timer) field_timer_unlink(fld_idx);
+}
+
+
+/*
+ * Get the counter of a field
+ */
+s16b field_counter(const field_type *f_ptr)
+{
+	int fld_idx = field_list_idx(f_ptr);
+
+	/* On the wheel */
+	if (fld_idx && fld_timer && fld_timer[fld_idx].due)
+	{
+		return ((s16b)(fld_timer[fld_idx].due - fld_tick));
+	}
+
+	return (f_ptr->counter);
+}
+
+
+/*
+ * Set the counter of a field
+ */
+void field_set_counter(field_type *f_ptr, s16b counter)
+{
+	f_ptr->counter = counter;
+
+	field_timer_set(f_ptr);
+}
+
+
+/*
+ * Recalculate the summary of the fields in a grid
+ */
+static void field_grid_update(cave_type *c_ptr)
+{
+	field_type *f_ptr;
+
+	u16b info = 0;
+	u16b type = 0;
+
+	FLD_ITT_START (c_ptr->fld_idx, f_ptr)
+	{
+		info |= f_ptr->info;
+		type |= FTYPE_FLAG(t_info[f_ptr->t_idx].type);
+	}
+	FLD_ITT_END;
+
+	c_ptr->fld_info = info & FIELD_INFO_GRID;
+	c_ptr->fld_type = type;
+}
+
+
 /*
  * Excise a field from a stack
  */
@@ -67,8 +314,8 @@ void excise_field_idx(int fld_idx)
 	field_type *j_ptr = NULL;
 	field_type *q_ptr;
 	
-	int y = j_ptr->fy;
-	int x = j_ptr->fx;
+	int y = f_ptr->fy;
+	int x = f_ptr->fx;
 
 	s16b *f_idx_ptr = &area(x, y)->fld_idx;
 	
@@ -103,6 +350,9 @@ void excise_field_idx(int fld_idx)
 		j_ptr = q_ptr;
 	}
 	FLD_ITT_END;
+
+	/* Update the summary */
+	field_grid_update(area(x, y));
 }
 
 
@@ -144,8 +394,14 @@ void delete_field_ptr(field_type *f_ptr)
 			/* Wipe the field */
 			field_wipe(f_ptr);
 
+			/* Recycle the field */
+			f_push(f_ptr);
+
 			/* Count fields */
 			fld_cnt--;
+
+			/* Update the summary */
+			field_grid_update(c_ptr);
 			
 			return;
 		}
@@ -176,6 +432,9 @@ void delete_field_location(cave_type *c_ptr)
 		/* Wipe the field */
 		field_wipe(f_ptr);
 
+		/* Recycle the field */
+		f_push(f_ptr);
+
 		/* Count fields */
 		fld_cnt--;
 	}
@@ -183,6 +442,8 @@ void delete_field_location(cave_type *c_ptr)
 
 	/* Nothing left */
 	c_ptr->fld_idx = 0;
+	c_ptr->fld_info = 0;
+	c_ptr->fld_type = 0;
 }
 
 
@@ -266,6 +527,15 @@ static void compact_fields_aux(int i1, int i2)
 		}
 	}
 
+	/* Move the timer */
+	if (fld_timer && fld_timer[i1].due)
+	{
+		s32b due = fld_timer[i1].due;
+
+		field_timer_unlink(i1);
+		field_timer_link(i2, due);
+	}
+
 	/* Structure copy */
 	fld_list[i2] = fld_list[i1];
 
@@ -285,6 +555,9 @@ static void compact_fields_aux(int i1, int i2)
  *
  * After "compacting" (if needed), we "reorder" the fields into a more
  * compact order, and we reset the allocation info, and the "live" array.
+ *
+ * f_pop() does not need this to find room, so it is only called when
+ * the list is nearly full, or has become mostly holes.
  */
 void compact_fields(int size)
 {
@@ -384,7 +657,7 @@ void compact_fields(int size)
 					{
 						/* Compact fields that are nearly done */
 						fld_level =
-							20 + 40 * f_ptr->counter / t_ptr->count_init;
+							20 + 40 * field_counter(f_ptr) / t_ptr->count_init;
 					}
 					else
 					{
@@ -398,7 +671,7 @@ void compact_fields(int size)
 				case FTYPE_CORPSE:
 				{
 					/* Corpses have no real value */
-					fld_level = f_ptr->counter / 10;
+					fld_level = field_counter(f_ptr) / 10;
 
 					break;
 				}
@@ -448,6 +721,12 @@ void compact_fields(int size)
 		/* Compress "fld_max" */
 		fld_max--;
 	}
+
+	/* Rebuild the free stack */
+	f_free_rebuild();
+
+	/* Count compactions */
+	fld_compacted++;
 }
 
 
@@ -486,6 +765,8 @@ void wipe_f_list(void)
 
 		/* Hack -- see above */
 		c_ptr->fld_idx = 0;
+		c_ptr->fld_info = 0;
+		c_ptr->fld_type = 0;
 
 		/* Wipe the field */
 		field_wipe(f_ptr);
@@ -496,6 +777,9 @@ void wipe_f_list(void)
 
 	/* Reset "fld_cnt" */
 	fld_cnt = 0;
+
+	/* Forget the holes */
+	fld_free_num = 0;
 }
 
 
@@ -531,6 +815,9 @@ void wipe_fields(int rg_idx)
  *
  * This routine should almost never fail, but in case it does,
  * we must be sure to handle "failure" of this routine.
+ *
+ * As in m_pop(), the list grows until it is full, and only then are
+ * dead fields reused.
  */
 s16b f_pop(void)
 {
@@ -554,15 +841,12 @@ s16b f_pop(void)
 
 
 	/* Recycle dead fields */
-	for (i = 1; i < fld_max; i++)
+	while (fld_free_num)
 	{
-		field_type *f_ptr;
+		i = fld_free[--fld_free_num];
 
-		/* Acquire field */
-		f_ptr = &fld_list[i];
-
-		/* Skip live fields */
-		if (f_ptr->t_idx) continue;
+		/* Skip stale entries */
+		if ((i >= fld_max) || fld_list[i].t_idx) continue;
 
 		/* Count fields */
 		fld_cnt++;
@@ -571,6 +855,11 @@ s16b f_pop(void)
 		return (i);
 	}
 
+	/* Look for holes the free stack has lost track of */
+	f_free_rebuild();
+
+	/* Found one */
+	if (fld_free_num) return (f_pop());
 
 	/* Warn the player (except during dungeon creation) */
 	if (character_dungeon) msgf("Too many fields!");
@@ -585,6 +874,9 @@ s16b f_pop(void)
  */
 void field_wipe(field_type *f_ptr)
 {
+	/* Forget the timer */
+	field_timer_forget(f_ptr);
+
 	/* Wipe the structure */
 	(void)WIPE(f_ptr, field_type);
 }
@@ -621,13 +913,13 @@ s16b field_add(field_type *f_ptr, cave_type *c_ptr)
 			s32b counter;
 		
 			/* Merge the two together */
-			counter = j_ptr->counter + f_ptr->counter;
+			counter = field_counter(j_ptr) + f_ptr->counter;
 
 			/* Bounds checking */
 			if (counter > MAX_SHORT) counter = MAX_SHORT;
 
 			/* Store in new counter */
-			j_ptr->counter = (s16b)counter;
+			field_set_counter(j_ptr, (s16b)counter);
 
 			/* Return index */
 			if (q_ptr)
@@ -671,6 +963,13 @@ s16b field_add(field_type *f_ptr, cave_type *c_ptr)
 		c_ptr->fld_idx = new_idx;
 	}
 
+	/* Start the countdown */
+	field_timer_set(&fld_list[new_idx]);
+
+	/* Add to the summary */
+	c_ptr->fld_info |= (f_ptr->info & FIELD_INFO_GRID);
+	c_ptr->fld_type |= FTYPE_FLAG(t_info[f_ptr->t_idx].type);
+
 	return (new_idx);
 }
 
@@ -796,6 +1095,9 @@ field_type *field_is_type(const cave_type *c_ptr, byte typ)
 {
 	field_type *f_ptr;
 
+	/* No field of that type here */
+	if (!(c_ptr->fld_type & FTYPE_FLAG(typ))) return (NULL);
+
 	/* While the field exists */
 	FLD_ITT_START (c_ptr->fld_idx, f_ptr)
 	{
@@ -817,6 +1119,9 @@ field_type *field_first_known(const cave_type *c_ptr, byte typ)
 {
 	field_type *f_ptr;
 
+	/* No field of that type here */
+	if (!(c_ptr->fld_type & FTYPE_FLAG(typ))) return (NULL);
+
 	/* While the field exists */
 	FLD_ITT_START (c_ptr->fld_idx, f_ptr)
 	{
@@ -843,6 +1148,9 @@ bool field_detect_type(const cave_type *c_ptr, byte typ)
 
 	bool flag = FALSE;
 
+	/* No field of that type here */
+	if (!(c_ptr->fld_type & FTYPE_FLAG(typ))) return (FALSE);
+
 	/* Scan the list */
 	FLD_ITT_START (c_ptr->fld_idx, f_ptr)
 	{
@@ -885,6 +1193,9 @@ void field_destroy_type(cave_type *c_ptr, byte typ)
 {
 	field_type *f_ptr;
 
+	/* No field of that type here */
+	if (!(c_ptr->fld_type & FTYPE_FLAG(typ))) return;
+
 	/* While the field exists */
 	FLD_ITT_START (c_ptr->fld_idx, f_ptr)
 	{
@@ -911,6 +1222,9 @@ u16b fields_have_flags(const cave_type *c_ptr, u16b info)
 
 	u16b flags = 0;
 
+	/* Most flags are summarised in the grid */
+	if (!(info & ~(FIELD_INFO_GRID))) return (c_ptr->fld_info & info);
+
 	/* Scan the fields */
 	FLD_ITT_START (c_ptr->fld_idx, f_ptr)
 	{
@@ -981,24 +1295,17 @@ field_type *place_field(int x, int y, s16b t_idx)
 bool field_script_single(field_type *f_ptr, int action, cptr format, ...)
 {
 	va_list vp;
-	cptr script;
 
-	/* Point to the field */
-	field_thaum *t_ptr = &t_info[f_ptr->t_idx];
-    
 	/* Paranoia - Is there a function to call? */
-	if (t_ptr->action[action])
+	if (field_has_trigger(f_ptr, action))
 	{
 		bool exists = TRUE;
 	
 		 /* Begin the Varargs Stuff */
 		va_start(vp, format);
 	
-		/* Get script to use */
-		script = quark_str(t_ptr->action[action]);
-	
 		/* Call the action script */
-		if (apply_field_trigger(script, f_ptr, format, vp))
+		if (field_trigger(f_ptr, action, format, vp))
 		{
 			/* The field wants to be deleted */
 			delete_field_ptr(f_ptr);
@@ -1039,22 +1346,15 @@ bool field_script_single(field_type *f_ptr, int action, cptr format, ...)
 void field_script_const(const field_type *f_ptr, int action, cptr format, ...)
 {
 	va_list vp;
-	cptr script;
 
-	/* Point to the field */
-	field_thaum *t_ptr = &t_info[f_ptr->t_idx];
-    
 	/* Paranoia - Is there a function to call? */
-	if (t_ptr->action[action])
+	if (field_has_trigger(f_ptr, action))
 	{
 		 /* Begin the Varargs Stuff */
 		va_start(vp, format);
 	
-		/* Get script to use */
-		script = quark_str(t_ptr->action[action]);
-	
 		/* Call the action script */
-		const_field_trigger(script, f_ptr, format, vp);
+		const_field_trigger(f_ptr, action, format, vp);
 		
 		/* End the Varargs Stuff */
 		va_end(vp);
@@ -1072,20 +1372,11 @@ void field_script_const(const field_type *f_ptr, int action, cptr format, ...)
 void field_script(cave_type *c_ptr, int action, cptr format, ...)
 {
 	field_type *f_ptr;
-	field_thaum *t_ptr;
-	
-	cptr script;
 
 	FLD_ITT_START (c_ptr->fld_idx, f_ptr);
 	{
-		/* Point to the field */
-		t_ptr = &t_info[f_ptr->t_idx];
-		
-		/* Get script to use */
-		script = quark_str(t_ptr->action[action]);
-
 		/* Paranoia - Is there a function to call? */
-		if (script)
+		if (field_has_trigger(f_ptr, action))
 		{
 			va_list vp;
 		
@@ -1093,7 +1384,7 @@ void field_script(cave_type *c_ptr, int action, cptr format, ...)
 			va_start(vp, format);
 					
 			/* Call the action script */
-			if (apply_field_trigger(script, f_ptr, format, vp))
+			if (field_trigger(f_ptr, action, format, vp))
 			{
 				/* The field wants to be deleted */
 				delete_field_ptr(f_ptr);
@@ -1118,19 +1409,14 @@ bool field_script_special(cave_type *c_ptr, u16b ftype, cptr format, ...)
 	field_thaum *t_ptr;
 
 	bool deleted = FALSE;
-	
-	cptr script;
     
 	FLD_ITT_START (c_ptr->fld_idx, f_ptr)
 	{
 		/* Point to the field */
 		t_ptr = &t_info[f_ptr->t_idx];
 		
-		/* Get script to use */
-		script = quark_str(t_ptr->action[FIELD_ACT_SPECIAL]);
-
 		/* Check for the right field + existance of a function to call */
-		if ((t_ptr->type == ftype) && script)
+		if ((t_ptr->type == ftype) && field_has_trigger(f_ptr, FIELD_ACT_SPECIAL))
 		{
 			va_list vp;
 		
@@ -1138,7 +1424,7 @@ bool field_script_special(cave_type *c_ptr, u16b ftype, cptr format, ...)
 			va_start(vp, format);
 		
 			/* Call the action script */
-			if (apply_field_trigger(script, f_ptr, format, vp))
+			if (field_trigger(f_ptr, FIELD_ACT_SPECIAL, format, vp))
 			{
 				/* The field wants to be deleted */
 				delete_field_ptr(f_ptr);
@@ -1164,26 +1450,18 @@ bool field_script_special(cave_type *c_ptr, u16b ftype, cptr format, ...)
 field_type *field_script_find(cave_type *c_ptr, int action, cptr format, ...)
 {
 	field_type *f_ptr;
-	field_thaum *t_ptr;
 	
 	va_list vp;
-	cptr script;
     
 	FLD_ITT_START (c_ptr->fld_idx, f_ptr)
 	{
-		/* Point to the field */
-		t_ptr = &t_info[f_ptr->t_idx];
-		
-		/* Get script to use */
-		script = quark_str(t_ptr->action[action]);
-		
-		if (script)
+		if (field_has_trigger(f_ptr, action))
 		{
 			/* Begin the Varargs Stuff */
 			va_start(vp, format);
 		
 			/* Call the action script */
-			if (apply_field_trigger(script, f_ptr, format, vp))
+			if (field_trigger(f_ptr, action, format, vp))
 			{
 				/* The field wants to be deleted */
 				delete_field_ptr(f_ptr);
@@ -1205,35 +1483,59 @@ field_type *field_script_find(cave_type *c_ptr, int action, cptr format, ...)
 
 void process_fields(void)
 {
-	s16b fld_idx;
+	int fld_idx, slot;
+
 	field_type *f_ptr;
 
-	for (fld_idx = 0; fld_idx < fld_max; fld_idx++)
+	/* Temporary fields count down every 10 turns */
+	if (turn % 10) return;
+
+	fld_tick++;
+
+	/* Nothing on the wheel */
+	if (!fld_timer) return;
+
+	/* A new block - spread out its list */
+	if (!(fld_tick & FLD_WHEEL_MASK))
 	{
-		/* Point to field */
-		f_ptr = &fld_list[fld_idx];
+		slot = FLD_WHEEL_SIZE + ((fld_tick >> FLD_WHEEL_BITS) & FLD_WHEEL_MASK);
 
-		/* No dead fields */
-		if (!f_ptr->t_idx) continue;
+		/* Take the whole list (fields may come back to it) */
+		fld_idx = fld_wheel[slot];
+		fld_wheel[slot] = 0;
 
-		/* If it is a temporary field, count down every 10 turns */
-		if ((f_ptr->info & FIELD_INFO_TEMP) && !(turn % 10))
+		while (fld_idx)
 		{
-			/* Decrement counter */
-			f_ptr->counter--;
+			field_timer *ft_ptr = &fld_timer[fld_idx];
 
-			/* If at bottom */
-			if (!f_ptr->counter)
-			{
-				/* Call completion routine */
-				field_script_single(f_ptr, FIELD_ACT_EXIT,
-									"b", LUA_VAR_NAMED(field_visible(f_ptr), "visible"));
+			int next_idx = ft_ptr->next;
 
-				/* Nothing else to do now */
-				continue;
-			}
+			field_timer_link(fld_idx, ft_ptr->due);
+
+			fld_idx = next_idx;
 		}
 	}
+
+	/* Everything in this list is due now */
+	slot = fld_tick & FLD_WHEEL_MASK;
+
+	/* The scripts may add or delete fields, so take one at a time */
+	while (fld_wheel[slot])
+	{
+		fld_idx = fld_wheel[slot];
+
+		field_timer_unlink(fld_idx);
+
+		/* Point to field */
+		f_ptr = &fld_list[fld_idx];
+
+		/* At bottom */
+		f_ptr->counter = 0;
+
+		/* Call completion routine */
+		field_script_single(f_ptr, FIELD_ACT_EXIT,
+							"b", LUA_VAR_NAMED(field_visible(f_ptr), "visible"));
+	}
 }
 
 
@@ -1733,7 +2035,7 @@ void make_lockjam_door(int x, int y, int power, bool jam)
 		}
 
 		/* Save old power */
-		old_power = f_ptr->counter;
+		old_power = field_counter(f_ptr);
 
 		/* Get rid of old field */
 		delete_field_ptr(f_ptr);
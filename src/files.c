@@ -342,6 +342,9 @@ errr process_pref_file_command(char *buf)
 			f_ptr = &f_info[i];
 			if (n1) f_ptr->x_attr = n1;
 			if (n2) f_ptr->x_char = n2;
+
+			/* The cached terrain glyphs are now wrong */
+			reset_glyph_cache();
 			return (0);
 		}
 	}
@@ -359,6 +362,9 @@ errr process_pref_file_command(char *buf)
 			f_ptr = &f_info[i];
 			if (n1) f_ptr->w_attr = n1;
 			if (n2) f_ptr->w_char = n2;
+
+			/* The cached terrain glyphs are now wrong */
+			reset_glyph_cache();
 			return (0);
 		}
 	}
@@ -1682,6 +1688,14 @@ void print_equippy(void)
 }
 
 
+/*
+ * The known flags of the equipment and of the player, worked out
+ * once for the whole flag screen instead of once per row.
+ */
+static object_flags flag_info_equip[EQUIP_MAX];
+static object_flags flag_info_player;
+
+
 /*
  * Helper function, see below
  */
@@ -1690,7 +1704,7 @@ static void display_player_flag_aux3(int col, int row,
 				    int n2, u32b flag2, int n3, u32b flag3)
 {
 	int i;
-	object_flags oflags;
+	object_flags *of_ptr;
 
 	/* Header */
 	put_fstr(col, row, header);
@@ -1702,28 +1716,23 @@ static void display_player_flag_aux3(int col, int row,
 	/* Check equipment */
 	for (i = 0; i < EQUIP_MAX; i++)
 	{
-		object_type *o_ptr;
-
-		/* Object */
-		o_ptr = &p_ptr->equipment[i];
-
 		/* Known flags */
-		object_flags_known(o_ptr, &oflags);
+		of_ptr = &flag_info_equip[i];
 
 		/* Default */
 		put_fstr(col, row, CLR_SLATE ".");
 
 		/* Check flags */
-		if (oflags.flags[n3] & flag3)
+		if (of_ptr->flags[n3] & flag3)
 		{
 			put_fstr(col, row, CLR_RED "v");
-			if (oflags.flags[n1] & flag1) put_fstr(col, row, CLR_RED "+");
-			if (oflags.flags[n2] & flag2) put_fstr(col, row, CLR_RED "*");
+			if (of_ptr->flags[n1] & flag1) put_fstr(col, row, CLR_RED "+");
+			if (of_ptr->flags[n2] & flag2) put_fstr(col, row, CLR_RED "*");
 		}
 		else
 		{
-			if (oflags.flags[n1] & flag1) put_fstr(col, row, "+");
-			if (oflags.flags[n2] & flag2) put_fstr(col, row, "*");
+			if (of_ptr->flags[n1] & flag1) put_fstr(col, row, "+");
+			if (of_ptr->flags[n2] & flag2) put_fstr(col, row, "*");
 		}
 
 		/* Advance */
@@ -1731,22 +1740,22 @@ static void display_player_flag_aux3(int col, int row,
 	}
 
 	/* Player flags */
-	player_flags(&oflags);
+	of_ptr = &flag_info_player;
 
 	/* Default */
 	put_fstr(col, row, CLR_SLATE ".");
 
 	/* Check flags */
-	if (oflags.flags[n3] & flag3)
+	if (of_ptr->flags[n3] & flag3)
 	{
 		put_fstr(col, row, CLR_RED "v");
-		if (oflags.flags[n1] & flag1) put_fstr(col, row, CLR_RED "+");
-		if (oflags.flags[n2] & flag2) put_fstr(col, row, CLR_RED "*");
+		if (of_ptr->flags[n1] & flag1) put_fstr(col, row, CLR_RED "+");
+		if (of_ptr->flags[n2] & flag2) put_fstr(col, row, CLR_RED "*");
 	}
 	else
 	{
-		if (oflags.flags[n1] & flag1) put_fstr(col, row, "+");
-		if (oflags.flags[n2] & flag2) put_fstr(col, row, "*");
+		if (of_ptr->flags[n1] & flag1) put_fstr(col, row, "+");
+		if (of_ptr->flags[n2] & flag2) put_fstr(col, row, "*");
 	}
 }
 
@@ -1768,9 +1777,19 @@ static void display_player_flag_aux(int col, int row,
  */
 static void display_player_flag_info(void)
 {
+	int i;
 	int row;
 	int col;
 
+	/* Get the known equipment flags */
+	for (i = 0; i < EQUIP_MAX; i++)
+	{
+		object_flags_known(&p_ptr->equipment[i], &flag_info_equip[i]);
+	}
+
+	/* Get the player flags */
+	player_flags(&flag_info_player);
+
 
 	/*** Set 1 ***/
 
@@ -3924,6 +3943,22 @@ void do_cmd_save_game(int is_autosave)
 	/* Autosaves do not disturb */
 	if (is_autosave)
 	{
+		/* The player is not dead */
+		(void)strcpy(p_ptr->state.died_from, "(saved)");
+
+		/* Handle stuff (the snapshot must be up to date) */
+		handle_stuff();
+
+		/* Try to save without stopping the game */
+		if (save_player_background())
+		{
+			/* Note that the player is not dead */
+			(void)strcpy(p_ptr->state.died_from, "(alive and well)");
+
+			/* Done */
+			return;
+		}
+
 		msgf("Autosaving the game...");
 	}
 	else
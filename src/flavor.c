@@ -487,6 +487,9 @@ void flavor_init(void)
 	cptr temp_adj;
 
 
+	/* The old descriptions use the old flavors */
+	object_desc_forget();
+
 	/* Hack -- Use the "simple" RNG */
 	Rand_quick = TRUE;
 
@@ -732,8 +735,8 @@ void flavor_init(void)
  *   2 -- The Cloak of Death [1,+3] (+2 to Stealth)
  *   3 -- The Cloak of Death [1,+3] (+2 to Stealth) {nifty}
  */
-void object_desc(char *buf, const object_type *o_ptr, int pref, int mode,
-                 int max)
+static void object_desc_aux(char *buf, const object_type *o_ptr, int pref,
+                            int mode, int max)
 {
 	cptr basenm, modstr;
 	int power;
@@ -1670,6 +1673,211 @@ void object_desc(char *buf, const object_type *o_ptr, int pref, int mode,
 	}
 }
 
+
+/*
+ * Size of the object description cache (a power of two)
+ */
+#define DESC_CACHE_SIZE		512
+
+/*
+ * Longest description that is cached
+ */
+#define DESC_CACHE_LEN		160
+
+
+/*
+ * Everything that an object description depends on
+ */
+typedef struct desc_key desc_key;
+
+struct desc_key
+{
+	object_type obj;	/* The object itself */
+
+	byte pref;	/* Arguments */
+	byte mode;
+
+	bool aware;	/* Knowledge of the object kind */
+	bool tried;
+	bool flavor;
+	bool easy_know;
+
+	bool plain;	/* plain_descriptions */
+	byte spell_book;	/* Realm of the player's books */
+
+	s16b str_use;	/* Strength (for bows) */
+
+	s16b bow_k_idx;	/* Launcher (for ammo) */
+	s16b bow_to_d;
+	bool bow_known;
+	s16b dis_to_d;
+	s16b bow_energy;
+	s16b ammo_mult;
+	bool xtra_might;
+	s16b num_fire;
+};
+
+/*
+ * An entry in the object description cache
+ */
+typedef struct desc_entry desc_entry;
+
+struct desc_entry
+{
+	u32b stamp;	/* Zero, or "desc_stamp" when it was made */
+	desc_key key;
+	char desc[DESC_CACHE_LEN];
+};
+
+/*
+ * The object description cache
+ */
+static desc_entry *desc_cache = NULL;
+
+/*
+ * Only entries made since the last object_desc_forget() are used
+ */
+static u32b desc_stamp = 1;
+
+
+/*
+ * Forget all the remembered object descriptions.
+ *
+ * This must be called whenever something that object_desc() uses,
+ * but which is not part of the key, changes.  (The flavors, and the
+ * strings that the inscription and name quarks point to.)
+ */
+void object_desc_forget(void)
+{
+	/* Nothing to forget */
+	if (!desc_cache) return;
+
+	/* Make the old entries stale */
+	desc_stamp++;
+
+	/* Hack -- Wrap around */
+	if (!desc_stamp)
+	{
+		(void)C_WIPE(desc_cache, DESC_CACHE_SIZE, desc_entry);
+		desc_stamp = 1;
+	}
+}
+
+
+/*
+ * Work out the key for an object description
+ */
+static void object_desc_key(desc_key *key, const object_type *o_ptr,
+                            int pref, int mode)
+{
+	object_kind *k_ptr = &k_info[o_ptr->k_idx];
+
+	/* Clear the padding, so the keys can be compared */
+	(void)WIPE(key, desc_key);
+
+	COPY(&key->obj, o_ptr, object_type);
+
+	key->pref = (byte)pref;
+	key->mode = (byte)mode;
+
+	key->aware = k_ptr->aware;
+	key->tried = k_ptr->tried;
+	key->flavor = (k_ptr->flavor) ? TRUE : FALSE;
+	key->easy_know = k_ptr->easy_know;
+
+	key->plain = plain_descriptions;
+	key->spell_book = mp_ptr->spell_book;
+
+	/* Long bows depend on the player's strength */
+	if (o_ptr->tval == TV_BOW) key->str_use = p_ptr->stat[A_STR].use;
+
+	/* Ammo shows the damage with the current launcher */
+	if (p_ptr->ammo_tval == o_ptr->tval)
+	{
+		object_type *bow_ptr = &p_ptr->equipment[EQUIP_BOW];
+
+		key->bow_k_idx = bow_ptr->k_idx;
+		key->bow_to_d = bow_ptr->to_d;
+		key->bow_known = object_known_p(bow_ptr) ? TRUE : FALSE;
+		key->dis_to_d = p_ptr->dis_to_d;
+		key->bow_energy = p_ptr->bow_energy;
+		key->ammo_mult = p_ptr->ammo_mult;
+		key->xtra_might = FLAG(p_ptr, TR_XTRA_MIGHT) ? TRUE : FALSE;
+		key->num_fire = p_ptr->num_fire;
+	}
+}
+
+
+/*
+ * Hash an object description key
+ */
+static int object_desc_hash(const desc_key *key)
+{
+	const byte *s = (const byte *)key;
+	u32b h = 2166136261UL;
+	uint i;
+
+	for (i = 0; i < sizeof(desc_key); i++)
+	{
+		h = (h ^ s[i]) * 16777619UL;
+	}
+
+	return ((int)((h ^ (h >> 16)) & (DESC_CACHE_SIZE - 1)));
+}
+
+
+/*
+ * Describe an object (see object_desc_aux() above)
+ *
+ * Inventory, equipment and store lists describe the same objects over
+ * and over, so the descriptions are remembered along with everything
+ * they depend on.  Any change to the object, such as identifying it,
+ * inscribing it or changing the size of the stack, makes a new key.
+ */
+void object_desc(char *buf, const object_type *o_ptr, int pref, int mode,
+                 int max)
+{
+	desc_key key;
+	desc_entry *d_ptr;
+	int len;
+
+	/* Make the cache */
+	if (!desc_cache) C_MAKE(desc_cache, DESC_CACHE_SIZE, desc_entry);
+
+	/* Get the key */
+	object_desc_key(&key, o_ptr, pref, mode);
+
+	d_ptr = &desc_cache[object_desc_hash(&key)];
+
+	/* Look for the description */
+	if ((d_ptr->stamp == desc_stamp) &&
+		!memcmp(&d_ptr->key, &key, sizeof(desc_key)))
+	{
+		len = strlen(d_ptr->desc);
+
+		/* It fits (so nothing was clipped) */
+		if (len + 1 < max)
+		{
+			strcpy(buf, d_ptr->desc);
+			return;
+		}
+	}
+
+	/* Describe the object */
+	object_desc_aux(buf, o_ptr, pref, mode, max);
+
+	len = strlen(buf);
+
+	/* Only remember descriptions that were not clipped */
+	if ((len + 1 < max) && (len < DESC_CACHE_LEN))
+	{
+		COPY(&d_ptr->key, &key, desc_key);
+		strcpy(d_ptr->desc, buf);
+		d_ptr->stamp = desc_stamp;
+	}
+}
+
+
 /*
  * Wrapper around object_desc() for the '%v'
  * format option.  This allows object_desc() to be
@@ -1024,6 +1024,139 @@ static bool level_gen(cptr *why, dun_type *d_ptr)
 }
 
 
+/*
+ * The region pool.
+ *
+ * Each region is stored in one "slab": the table of row pointers,
+ * followed by the rows themselves, one after the other.  This needs a
+ * single allocation per region (rather than one per row), and keeps
+ * the whole cave in one place in memory.
+ *
+ * Dead slabs are not freed, but are kept on a free list by size class
+ * (the slab size rounded up to a power of two) so the next region of a
+ * similar size can reuse them.  Dungeon levels and wilderness towns
+ * come and go all the time, and are nearly always the same few sizes.
+ */
+#define REGION_POOL_CLASSES		32
+#define REGION_POOL_DEPTH		4
+
+/*
+ * A free slab (stored in the slab itself)
+ */
+typedef struct region_slab region_slab;
+
+struct region_slab
+{
+	region_slab *next;
+};
+
+static region_slab *region_pool[REGION_POOL_CLASSES];
+static int region_pool_cnt[REGION_POOL_CLASSES];
+
+
+/*
+ * Get the size class of a slab holding a region of the given size
+ */
+static int region_slab_class(int x, int y)
+{
+	huge size = C_SIZE(y, cave_type *) + C_SIZE(x * y, cave_type);
+	int class = 0;
+
+	/* Round up to a power of two */
+	while (((huge)1 << class) < size) class++;
+
+	/* Paranoia */
+	if (class >= REGION_POOL_CLASSES) quit("Region too large!");
+
+	return (class);
+}
+
+
+/*
+ * Get a wiped slab for an "x" by "y" region, and set up its row table
+ */
+static region_type region_slab_make(int x, int y)
+{
+	int class = region_slab_class(x, y);
+	region_type rows;
+	cave_type *c_ptr;
+	int i;
+
+	if (region_pool[class])
+	{
+		/* Reuse a dead slab */
+		rows = (region_type)region_pool[class];
+		region_pool[class] = region_pool[class]->next;
+		region_pool_cnt[class]--;
+
+		/* Wipe the part we use */
+		(void)C_WIPE(rows, C_SIZE(y, cave_type *) + C_SIZE(x * y, cave_type),
+		             byte);
+	}
+	else
+	{
+		/* Make a new slab */
+		rows = (region_type)C_ZNEW((huge)1 << class, byte);
+	}
+
+	/* The rows start after the row table */
+	c_ptr = (cave_type *)(rows + y);
+
+	/* Point to each row */
+	for (i = 0; i < y; i++)
+	{
+		rows[i] = c_ptr + i * x;
+	}
+
+	return (rows);
+}
+
+
+/*
+ * Give a slab back to the pool
+ */
+static void region_slab_free(vptr slab, int x, int y)
+{
+	int class = region_slab_class(x, y);
+	region_slab *s_ptr = (region_slab *)slab;
+
+	/* Don't hoard too many of one size */
+	if (region_pool_cnt[class] >= REGION_POOL_DEPTH)
+	{
+		FREE(slab);
+		return;
+	}
+
+	/* Add to the free list */
+	s_ptr->next = region_pool[class];
+	region_pool[class] = s_ptr;
+	region_pool_cnt[class]++;
+}
+
+
+/*
+ * Free all the spare slabs in the region pool
+ */
+void wipe_region_pool(void)
+{
+	region_slab *s_ptr;
+	int i;
+
+	for (i = 0; i < REGION_POOL_CLASSES; i++)
+	{
+		while (region_pool[i])
+		{
+			s_ptr = region_pool[i];
+			region_pool[i] = s_ptr->next;
+
+			FREE(s_ptr);
+		}
+
+		region_pool_cnt[i] = 0;
+	}
+}
+
+
 /*
  * Delete a region from the region list
  *
@@ -1078,17 +1211,11 @@ void del_region(int rg_idx)
 		}
 	}
 
-	/* Deallocate the cave information */
+	/* Give the cave back to the pool */
+	region_slab_free((vptr)rg_list[rg_idx], ri_ptr->xsize, ri_ptr->ysize);
 
-	/* Free the cave */
-	for (i = 0; i < ri_ptr->ysize; i++)
-	{
-		/* Deallocate one row of the cave */
-		FREE(rg_list[rg_idx][i]);
-	}
-
-	/* Free the region + info */
-	KILL(rg_list[rg_idx]);
+	/* Forget the region + info */
+	rg_list[rg_idx] = NULL;
 	(void)WIPE(&ri_list[rg_idx], region_info);
 
 	/* Decrement counter */
@@ -1190,8 +1317,6 @@ void wipe_rg_list(void)
  */
 static void allocate_region(int rg_idx, int x, int y)
 {
-	int i;
-
 	/* Acquire region info */
 	region_info *ri_ptr = &ri_list[rg_idx];
 
@@ -1202,15 +1327,8 @@ static void allocate_region(int rg_idx, int x, int y)
 	/* Hack set the refcount to zero - assume caller increments refcount */
 	ri_ptr->refcount = 0;
 
-	/* Make the array of pointers to the cave */
-	C_MAKE(rg_list[rg_idx], y, cave_type *);
-
-	/* Allocate and wipe each line of the region */
-	for (i = 0; i < y; i++)
-	{
-		/* Allocate one row of the cave */
-		C_MAKE(rg_list[rg_idx][i], x, cave_type);
-	}
+	/* Get the cave (and the pointers to its rows) from the pool */
+	rg_list[rg_idx] = region_slab_make(x, y);
 
 	/* Hack - set this region to be the currently used one */
 	set_region(rg_idx);
@@ -36,7 +36,7 @@
 # if defined(Pyramid) || defined(NeXT) || defined(SUNOS) || \
      defined(NCR3K) || defined(SUNOS) || defined(ibm032) || \
      defined(__osf__) || defined(ISC) || defined(SGI) || \
-     defined(linux)
+     defined(linux) || defined(__linux__)
 #  include <sys/time.h>
 # endif
 
@@ -91,6 +91,8 @@
 
 # include <sys/stat.h>
 
+# include <sys/wait.h>
+
 # ifdef SOLARIS
 #  include <netdb.h>
 # endif
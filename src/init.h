@@ -87,6 +87,8 @@ struct header
 
 	u32b text_size;	/* Size of the "text" array in bytes */
 
+	u32b text_hash;	/* Hash of the template file (see info_hash_line()) */
+
 	void *info_ptr;
 	char *name_ptr;
 	char *text_ptr;
@@ -99,7 +101,13 @@ struct header
 extern errr init_info_txt(FILE *fp, char *buf, header *head,
 						  parse_info_txt_func parse_info_txt_line);
 
+/*
+ * Starting value for info_hash_line()
+ */
+#define INFO_HASH_INIT	2166136261UL
+
 #ifdef ALLOW_TEMPLATES
+extern u32b info_hash_line(u32b hash, cptr buf);
 extern errr parse_z_info(char *buf, header *head);
 extern errr parse_v_info(char *buf, header *head);
 extern errr parse_f_info(char *buf, header *head);
@@ -741,6 +741,26 @@ static cptr t_info_triggers[] =
 /*
  * Initialize an "*_info" array, by parsing an ascii "template" file
  */
+/*
+ * Add a line of a template file to the hash of the file (FNV-1a).
+ *
+ * The hash is kept in the "raw" file, so that a template file which
+ * is newer than the "raw" file, but has not changed, is not parsed.
+ */
+u32b info_hash_line(u32b hash, cptr buf)
+{
+	/* Hash the characters and the end of the line */
+	do
+	{
+		hash ^= (byte)*buf;
+		hash = (hash * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	while (*buf++);
+
+	return (hash);
+}
+
+
 errr init_info_txt(FILE *fp, char *buf, header *head,
                    parse_info_txt_func parse_info_txt_line)
 {
@@ -760,12 +780,18 @@ errr init_info_txt(FILE *fp, char *buf, header *head,
 	head->name_size = 0;
 	head->text_size = 0;
 
+	/* Start the hash */
+	head->text_hash = INFO_HASH_INIT;
+
 	/* Parse */
 	while (0 == my_fgets(fp, buf, 1024))
 	{
 		/* Advance the line number */
 		error_line++;
 
+		/* Hash the line */
+		head->text_hash = info_hash_line(head->text_hash, buf);
+
 		/* Skip comments and blank lines */
 		if (!buf[0] || (buf[0] == '#')) continue;
 
@@ -1333,19 +1359,114 @@ errr parse_f_info(char *buf, header *head)
 }
 
 
+/*
+ * Hash tables for the arrays of 32 flag names.
+ *
+ * The monster and object flags are spread over several arrays, which
+ * are tried one by one.  Rather than compare the name against every
+ * entry of every array, each array gets a table of the bit numbers
+ * indexed by a hash of the name, made the first time it is used.
+ */
+#define FLAG_HASH_SIZE	64
+#define FLAG_HASH_MAX	16
+
+typedef struct flag_hash_type flag_hash_type;
+
+struct flag_hash_type
+{
+	cptr *names;	/* The array of names */
+
+	byte bit[FLAG_HASH_SIZE];	/* Bit number + 1 (0 = empty) */
+};
+
+static flag_hash_type flag_hash[FLAG_HASH_MAX];
+static int flag_hash_num = 0;
+
+
+/*
+ * Hash a flag name
+ */
+static int flag_name_hash(cptr s)
+{
+	uint hash = 0;
+
+	while (*s) hash = hash * 33 + (byte)*s++;
+
+	return (hash % FLAG_HASH_SIZE);
+}
+
+
+/*
+ * Get the hash table for an array of flag names
+ */
+static flag_hash_type *flag_hash_get(cptr names[])
+{
+	flag_hash_type *fh_ptr;
+
+	int i, j;
+
+	/* Look for it */
+	for (i = 0; i < flag_hash_num; i++)
+	{
+		if (flag_hash[i].names == names) return (&flag_hash[i]);
+	}
+
+	/* No room */
+	if (flag_hash_num >= FLAG_HASH_MAX) return (NULL);
+
+	/* Make it */
+	fh_ptr = &flag_hash[flag_hash_num++];
+
+	fh_ptr->names = names;
+
+	for (i = 0; i < 32; i++)
+	{
+		/* Find a space (or an earlier copy of the name) */
+		for (j = flag_name_hash(names[i]); fh_ptr->bit[j];
+			 j = (j + 1) % FLAG_HASH_SIZE)
+		{
+			if (streq(names[fh_ptr->bit[j] - 1], names[i])) break;
+		}
+
+		/* The first copy of a name wins */
+		if (!fh_ptr->bit[j]) fh_ptr->bit[j] = i + 1;
+	}
+
+	return (fh_ptr);
+}
+
+
 /*
  * Grab one flag from a textual string
  */
 static errr grab_one_flag(u32b *flags, cptr names[], cptr what)
 {
+	flag_hash_type *fh_ptr = flag_hash_get(names);
+
 	int i;
 
-	/* Check flags */
-	for (i = 0; i < 32; i++)
+	/* Paranoia - no hash table */
+	if (!fh_ptr)
 	{
-		if (streq(what, names[i]))
+		/* Check flags */
+		for (i = 0; i < 32; i++)
 		{
-			*flags |= (1L << i);
+			if (streq(what, names[i]))
+			{
+				*flags |= (1L << i);
+				return (0);
+			}
+		}
+
+		return (-1);
+	}
+
+	/* Look it up */
+	for (i = flag_name_hash(what); fh_ptr->bit[i]; i = (i + 1) % FLAG_HASH_SIZE)
+	{
+		if (streq(what, names[fh_ptr->bit[i] - 1]))
+		{
+			*flags |= (1L << (fh_ptr->bit[i] - 1));
 			return (0);
 		}
 	}
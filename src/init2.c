@@ -313,6 +313,60 @@ extern errr check_modification_date(int fd, cptr template_file)
 #endif /* CHECK_MODIFICATION_TIME */
 #endif /* !RISCOS */
 
+
+#ifdef ALLOW_TEMPLATES
+#ifdef CHECK_MODIFICATION_TIME
+
+/*
+ * See if a "raw" file was made from a template file which is newer
+ * than it, by comparing the hash of the template file.
+ *
+ * This saves parsing template files which have been touched, but not
+ * changed (for example by a fresh checkout).
+ */
+static errr check_info_hash(int fd, cptr template_file)
+{
+	header test;
+
+	FILE *fp;
+
+	char buf[1024];
+
+	u32b hash = INFO_HASH_INIT;
+
+	/* Read the header (and go back to the start) */
+	if (fd_read(fd, (char *)(&test), sizeof(header)) || fd_seek(fd, 0))
+	{
+		return (-1);
+	}
+
+	/* Old "raw" file */
+	if (test.head_size != sizeof(header)) return (-1);
+
+	/* Build the filename */
+	path_make(buf, ANGBAND_DIR_EDIT, template_file);
+
+	/* Open the file */
+	fp = my_fopen(buf, "r");
+
+	if (!fp) return (-1);
+
+	/* Hash it, as init_info_txt() does */
+	while (0 == my_fgets(fp, buf, 1024))
+	{
+		hash = info_hash_line(hash, buf);
+	}
+
+	/* Close it */
+	my_fclose(fp);
+
+	/* Has it changed? */
+	return ((hash == test.text_hash) ? 0 : -1);
+}
+
+#endif /* CHECK_MODIFICATION_TIME */
+#endif /* ALLOW_TEMPLATES */
+
 /*
  * File headers
  */
@@ -506,6 +560,9 @@ static errr init_info(cptr filename, header *head,
 
 		err = check_modification_date(fd, format("%s.txt", filename));
 
+		/* The template file may not have really changed */
+		if (err) err = check_info_hash(fd, format("%s.txt", filename));
+
 #endif /* CHECK_MODIFICATION_TIME */
 
 		/* Attempt to parse the "raw" file */
@@ -963,8 +1020,8 @@ errr init_t_info(void)
 		quit("Error in 't_info.txt' file.");
 	}
 
-	/* Success */
-	return (0);
+	/* Look up the field actions */
+	return (init_field_triggers());
 }
 
 /*
@@ -1225,6 +1282,13 @@ static errr init_alloc(void)
 	/* Allocate the alloc_race_table */
 	C_MAKE(alloc_race_table, alloc_race_size, alloc_entry);
 
+	/* Allocate the running totals and the list of entries to check */
+	C_MAKE(alloc_race_cum, alloc_race_size + 1, s32b);
+	C_MAKE(alloc_race_check, alloc_race_size, s16b);
+
+	/* Forget the old restrictions */
+	get_mon_num_prep_forget();
+
 	/* Get the table entry */
 	table = alloc_race_table;
 
@@ -1271,6 +1335,357 @@ static errr init_alloc(void)
 }
 
 
+/*
+ * Start up profiling (see the "-p" command line option)
+ *
+ * Each phase of the start up records the time it took, the number of
+ * allocations it made (and their size), and the number of bytes it
+ * read from files.  A phase which is started more than once simply
+ * adds to its old totals.
+ */
+
+/*
+ * Maximum number of start up phases
+ */
+#define STARTUP_PHASE_MAX	32
+
+typedef struct startup_phase_type startup_phase_type;
+
+struct startup_phase_type
+{
+	cptr name;	/* Name of the phase */
+
+	long usec;	/* Time taken (in microseconds) */
+
+	u32b allocs;	/* Number of allocations */
+	huge alloc_bytes;	/* Bytes allocated */
+	huge read_bytes;	/* Bytes read from files */
+
+	long budget;	/* Most time allowed (in milliseconds), or -1 */
+};
+
+static startup_phase_type startup_list[STARTUP_PHASE_MAX];
+static int startup_num = 0;
+
+/* The current phase, and the counters when it started */
+static startup_phase_type *startup_cur = NULL;
+static u32b startup_usec_start;
+static u32b startup_allocs_start;
+static huge startup_alloc_start;
+static huge startup_read_start;
+
+/* Budget for the whole start up (in milliseconds), or -1 */
+static long startup_budget = -1;
+
+
+/*
+ * Finish the current start up phase, and start the named one.
+ *
+ * A NULL name just finishes the current phase.
+ */
+void startup_phase(cptr name)
+{
+	startup_phase_type *ph_ptr = startup_cur;
+
+	u32b now;
+
+	int i;
+
+	/* Not profiling */
+	if (!arg_profile) return;
+
+	now = time_usec();
+
+	/* Finish the current phase */
+	if (ph_ptr)
+	{
+		ph_ptr->usec += (long)(now - startup_usec_start);
+		ph_ptr->allocs += ralloc_count - startup_allocs_start;
+		ph_ptr->alloc_bytes += ralloc_total - startup_alloc_start;
+		ph_ptr->read_bytes += file_bytes_read - startup_read_start;
+
+		startup_cur = NULL;
+	}
+
+	/* Nothing to start */
+	if (!name) return;
+
+	/* Look for an old phase with this name */
+	for (i = 0; i < startup_num; i++)
+	{
+		if (streq(startup_list[i].name, name)) break;
+	}
+
+	/* Make a new one */
+	if (i == startup_num)
+	{
+		/* Too many phases */
+		if (startup_num == STARTUP_PHASE_MAX) return;
+
+		ph_ptr = &startup_list[startup_num++];
+
+		ph_ptr->name = name;
+		ph_ptr->budget = -1;
+	}
+
+	/* Start the phase */
+	startup_cur = &startup_list[i];
+	startup_usec_start = now;
+	startup_allocs_start = ralloc_count;
+	startup_alloc_start = ralloc_total;
+	startup_read_start = file_bytes_read;
+}
+
+
+/*
+ * Add up all the phases
+ */
+static void startup_total(startup_phase_type *ph_ptr)
+{
+	int i;
+
+	(void)WIPE(ph_ptr, startup_phase_type);
+
+	ph_ptr->name = "total";
+	ph_ptr->budget = startup_budget;
+
+	for (i = 0; i < startup_num; i++)
+	{
+		ph_ptr->usec += startup_list[i].usec;
+		ph_ptr->allocs += startup_list[i].allocs;
+		ph_ptr->alloc_bytes += startup_list[i].alloc_bytes;
+		ph_ptr->read_bytes += startup_list[i].read_bytes;
+	}
+}
+
+
+/*
+ * Is a phase over its budget?
+ */
+static bool startup_over_budget(const startup_phase_type *ph_ptr)
+{
+	return ((ph_ptr->budget >= 0) && (ph_ptr->usec > ph_ptr->budget * 1000L));
+}
+
+
+/*
+ * Print one line of the start up report
+ */
+static void startup_dump_aux(const startup_phase_type *ph_ptr)
+{
+	froff(stdout, "%-12s %6ld.%03ld %8lu %10lu %10lu%s\n", ph_ptr->name,
+		  ph_ptr->usec / 1000L, ph_ptr->usec % 1000L,
+		  (unsigned long)ph_ptr->allocs, (unsigned long)ph_ptr->alloc_bytes,
+		  (unsigned long)ph_ptr->read_bytes,
+		  startup_over_budget(ph_ptr) ? "  (over budget)" : "");
+}
+
+
+/*
+ * Print the start up report.
+ *
+ * This is called as the game exits (after the display has been shut
+ * down), so it even works if the game failed to start.
+ */
+void startup_dump(void)
+{
+	startup_phase_type total;
+
+	int i;
+
+	/* Nothing to report */
+	if (!startup_num) return;
+
+	/* Finish the current phase */
+	startup_phase(NULL);
+
+	froff(stdout, "%-12s %10s %8s %10s %10s\n",
+		  "Phase", "msec", "allocs", "bytes", "read");
+
+	for (i = 0; i < startup_num; i++)
+	{
+		startup_dump_aux(&startup_list[i]);
+	}
+
+	startup_total(&total);
+	startup_dump_aux(&total);
+}
+
+
+/*
+ * Write one phase of the start up report as JSON
+ */
+static void startup_json_aux(FILE *fff, const startup_phase_type *ph_ptr,
+                             bool last)
+{
+	froff(fff, "    {\"name\": \"%s\", \"usec\": %ld, \"allocs\": %lu, "
+		  "\"alloc_bytes\": %lu, \"read_bytes\": %lu",
+		  ph_ptr->name, ph_ptr->usec, (unsigned long)ph_ptr->allocs,
+		  (unsigned long)ph_ptr->alloc_bytes,
+		  (unsigned long)ph_ptr->read_bytes);
+
+	if (ph_ptr->budget >= 0)
+	{
+		froff(fff, ", \"budget_msec\": %ld, \"over_budget\": %s",
+			  ph_ptr->budget, startup_over_budget(ph_ptr) ? "true" : "false");
+	}
+
+	froff(fff, "}%s\n", last ? "" : ",");
+}
+
+
+/*
+ * Read the start up budgets.
+ *
+ * Each line is "<phase>:<msec>", where the phase "total" is the
+ * whole start up.  Blank lines and lines starting with '#' are
+ * ignored.
+ */
+static errr startup_read_budget(cptr file)
+{
+	FILE *fff;
+
+	char buf[1024];
+
+	char *s;
+
+	int i;
+
+	long msec;
+
+	fff = my_fopen(file, "r");
+
+	/* Failure */
+	if (!fff) return (-1);
+
+	while (0 == my_fgets(fff, buf, 1024))
+	{
+		/* Skip comments and blank lines */
+		if (!buf[0] || (buf[0] == '#')) continue;
+
+		/* Find the colon */
+		s = strchr(buf, ':');
+
+		/* Ignore nonsense */
+		if (!s) continue;
+
+		/* Split the line */
+		*s++ = '\0';
+
+		msec = atol(s);
+
+		/* The whole start up */
+		if (streq(buf, "total"))
+		{
+			startup_budget = msec;
+			continue;
+		}
+
+		/* Find the phase */
+		for (i = 0; i < startup_num; i++)
+		{
+			if (streq(startup_list[i].name, buf))
+			{
+				startup_list[i].budget = msec;
+			}
+		}
+	}
+
+	my_fclose(fff);
+
+	/* Success */
+	return (0);
+}
+
+
+/*
+ * Finish profiling the start up.
+ *
+ * Write the JSON report (if asked for), and check the budgets (if
+ * there are any).  Returns an error message for "quit()", or NULL
+ * if everything is fine.
+ */
+cptr startup_report(void)
+{
+	static char err[1024];
+
+	startup_phase_type total;
+
+	FILE *fff;
+
+	int i;
+
+	/* Finish the current phase */
+	startup_phase(NULL);
+
+	/* Read the budgets */
+	if (arg_profile_budget && startup_read_budget(arg_profile_budget))
+	{
+		strnfmt(err, 1024, "Cannot read the budget file '%s'",
+				arg_profile_budget);
+		return (err);
+	}
+
+	startup_total(&total);
+
+	/* No problems yet */
+	err[0] = '\0';
+
+	/* Find the first phase over budget */
+	for (i = 0; i < startup_num; i++)
+	{
+		if (startup_over_budget(&startup_list[i]))
+		{
+			strnfmt(err, 1024,
+					"Start up phase '%s' took %ld.%03ld ms (budget %ld ms)",
+					startup_list[i].name, startup_list[i].usec / 1000L,
+					startup_list[i].usec % 1000L, startup_list[i].budget);
+			break;
+		}
+	}
+
+	/* Check the whole start up */
+	if (!err[0] && startup_over_budget(&total))
+	{
+		strnfmt(err, 1024, "Start up took %ld.%03ld ms (budget %ld ms)",
+				total.usec / 1000L, total.usec % 1000L, total.budget);
+	}
+
+	/* Write the JSON report */
+	if (arg_profile_json)
+	{
+		fff = my_fopen(arg_profile_json, "w");
+
+		/* Failure */
+		if (!fff)
+		{
+			strnfmt(err, 1024, "Cannot write the report file '%s'",
+					arg_profile_json);
+			return (err);
+		}
+
+		froff(fff, "{\n  \"phases\": [\n");
+
+		for (i = 0; i < startup_num; i++)
+		{
+			startup_json_aux(fff, &startup_list[i], (bool)(i == startup_num - 1));
+		}
+
+		froff(fff, "  ],\n  \"total\":\n");
+		startup_json_aux(fff, &total, TRUE);
+		froff(fff, "}\n");
+
+		my_fclose(fff);
+	}
+
+	/* Over budget */
+	if (err[0]) return (err);
+
+	/* Success */
+	return (NULL);
+}
+
+
 /*
  * Hack -- take notes on line 23
  */
@@ -1366,6 +1781,8 @@ void init_angband(void)
 
 	/*** Verify the "news" file ***/
 
+	startup_phase("news");
+
 	/* Build the filename */
 	path_make(buf, ANGBAND_DIR_FILE, "news.txt");
 
@@ -1422,6 +1839,8 @@ void init_angband(void)
 
 	/*** Verify (or create) the "high score" file ***/
 
+	startup_phase("scores");
+
 	/* Build the filename */
 	path_make(buf, ANGBAND_DIR_APEX, "scores.raw");
 
@@ -1464,6 +1883,7 @@ void init_angband(void)
 	init_term_callbacks();
 
 	/* Initialize size info */
+	startup_phase("z_info");
 	note("[Initializing array sizes...]");
 	if (init_z_info()) quit("Cannot initialize sizes");
 #if 0
@@ -1472,38 +1892,47 @@ void init_angband(void)
 	if (script_init()) quit("Cannot initialize scripts");
 #endif
 	/* Initialize feature info */
+	startup_phase("f_info");
 	note("[Initializing arrays... (features)]");
 	if (init_f_info()) quit("Cannot initialize features");
 
 	/* Initialize object info */
+	startup_phase("k_info");
 	note("[Initializing arrays... (objects)]");
 	if (init_k_info()) quit("Cannot initialize objects");
 
 	/* Initialize artifact info */
+	startup_phase("a_info");
 	note("[Initializing arrays... (artifacts)]");
 	if (init_a_info()) quit("Cannot initialize artifacts");
 
 	/* Initialize ego-item info */
+	startup_phase("e_info");
 	note("[Initializing arrays... (ego-items)]");
 	if (init_e_info()) quit("Cannot initialize ego-items");
 
 	/* Initialize monster info */
+	startup_phase("r_info");
 	note("[Initializing arrays... (monsters)]");
 	if (init_r_info()) quit("Cannot initialize monsters");
 
 	/* Initialize feature info */
+	startup_phase("v_info");
 	note("[Initializing arrays... (vaults)]");
 	if (init_v_info()) quit("Cannot initialize vaults");
 
 	/* Initialize quest array */
+	startup_phase("quests");
 	note("[Initializing arrays... (quests)]");
 	if (init_quests()) quit("Cannot initialize quests");
 
 	/* Initialize some other arrays */
+	startup_phase("other");
 	note("[Initializing arrays... (other)]");
 	if (init_other()) quit("Cannot initialize other stuff");
 
 	/* Initialize some other arrays */
+	startup_phase("alloc");
 	note("[Initializing arrays... (alloc)]");
 	if (init_alloc()) quit("Cannot initialize alloc stuff");
 
@@ -1511,6 +1940,7 @@ void init_angband(void)
 	/*** Load default user pref files ***/
 
 	/* Initialize feature info */
+	startup_phase("prefs");
 	note("[Initializing user pref files...]");
 
 	/* Access the "basic" pref file */
@@ -1524,9 +1954,11 @@ void init_angband(void)
 					   || streq(ANGBAND_SYS, "ibm")) ? TRUE : FALSE;
 	
 	/* Initialise the overhead map */
+	startup_phase("map");
 	init_overhead_map();
 	
 	/* Done */
+	startup_phase(NULL);
 	note("[Initialization complete]");
 }
 
@@ -1556,10 +1988,17 @@ void cleanup_angband(void)
 		}
 	}
 
+	/* Free the remembered restrictions */
+	get_mon_num_prep_forget();
+	get_obj_num_prep_forget();
+
 	/* Free the allocation tables */
 	FREE(alloc_ego_table);
 	FREE(alloc_race_table);
+	FREE(alloc_race_cum);
+	FREE(alloc_race_check);
 	FREE(alloc_kind_table);
+	FREE(alloc_kind_cum);
 
 	/* Free the towns */
 	FREE(place);
@@ -1570,6 +2009,9 @@ void cleanup_angband(void)
 	/* Free the quest list */
 	FREE(quest);
 
+	/* Free the field actions */
+	free_field_triggers();
+
 	/* Free the lore, monster, and object lists */
 	FREE(m_list);
 	FREE(o_list);
@@ -1585,6 +2027,9 @@ void cleanup_angband(void)
 	/* Delete the overhead map */
 	del_overhead_map();
 
+	/* Free the spare region slabs */
+	wipe_region_pool();
+
 /*
  * Note that this causes problems if Zangband exits due to an error
  * parsing the info files since at that point the wilderness is not
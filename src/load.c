@@ -278,6 +278,41 @@ static void strip_bytes(int n)
 	while (n--) rd_byte(&tmp8u);
 }
 
+
+/*
+ * Read a packed "section" of exactly "len" bytes (see "wr_section()")
+ */
+static errr rd_section(byte *data, u32b len)
+{
+	byte *packed;
+	u32b raw, size, i;
+	errr err;
+
+	/* Section header */
+	rd_u32b(&raw);
+	rd_u32b(&size);
+
+	/* Paranoia */
+	if ((raw != len) || (size > lz_bound(len)))
+	{
+		note("Bad section size (%lu bytes)!", (unsigned long)raw);
+		return (-1);
+	}
+
+	/* Read the data */
+	C_MAKE(packed, size, byte);
+	for (i = 0; i < size; i++) rd_byte(&packed[i]);
+
+	/* Unpack it */
+	err = lz_unpack(packed, size, data, len);
+
+	FREE(packed);
+
+	if (err) note("Corrupt section!");
+
+	return (err);
+}
+
 #ifdef UNUSED_FUNC
 
 /*
@@ -1114,8 +1149,14 @@ static void rd_options(void)
 
 	/*** Oops ***/
 
+	/* Read "window_delay" (in the old option space) */
+	rd_byte(&window_delay);
+
+	/* Hack -- Ignore junk from very old savefiles */
+	if (window_delay > 9) window_delay = 0;
+
 	/* Ignore old options */
-	strip_bytes(16);
+	strip_bytes(15);
 
 
 	/*** Special info */
@@ -1663,10 +1704,72 @@ static void fix_tile(cave_type *c_ptr)
 }
 
 
+/* The version when the maps were first packed */
+#define VERSION_PACKED_MAP		53
+
+
+/*
+ * Load a packed dungeon or wilderness map (see "save_map()")
+ */
+static errr load_map_packed(int xmin, int ymin, int xmax, int ymax)
+{
+	int y, x;
+
+	u32b size = (u32b)(xmax - xmin) * (u32b)(ymax - ymin);
+
+	byte *plane, *info, *player, *pfeat, *feat;
+
+	cave_type *c_ptr;
+	pcave_type *pc_ptr;
+
+	/* Get the planes */
+	C_MAKE(plane, size * 4, byte);
+
+	if (rd_section(plane, size * 4))
+	{
+		FREE(plane);
+		return (-1);
+	}
+
+	info = plane;
+	player = info + size;
+	pfeat = player + size;
+	feat = pfeat + size;
+
+	/* Apply them */
+	for (y = ymin; y < ymax; y++)
+	{
+		for (x = xmin; x < xmax; x++)
+		{
+			/* Access the cave */
+			c_ptr = area(x, y);
+			pc_ptr = parea(x, y);
+
+			/* Extract "info" (without the CAVE_ROOM flag set) */
+			c_ptr->info = (*info++ & (CAVE_GLOW | CAVE_ICKY));
+
+			/* Extract "player info" (only use detect grid data) */
+			pc_ptr->player = (*player++ & (GRID_DTCT));
+
+			/* Extract the remembered "feat" */
+			pc_ptr->feat = *pfeat++;
+
+			/* Extract "feat" */
+			c_ptr->feat = *feat++;
+		}
+	}
+
+	FREE(plane);
+
+	/* Success */
+	return (0);
+}
+
+
 /*
  * Load dungeon or wilderness map
  */
-static void load_map(int xmin, int ymin, int xmax, int ymax)
+static errr load_map(int xmin, int ymin, int xmax, int ymax)
 {
 	int i, y, x;
 	byte count;
@@ -1676,6 +1779,12 @@ static void load_map(int xmin, int ymin, int xmax, int ymax)
 	cave_type *c_ptr;
 	pcave_type *pc_ptr;
 
+	/* Packed savefiles */
+	if (sf_version >= VERSION_PACKED_MAP)
+	{
+		return (load_map_packed(xmin, ymin, xmax, ymax));
+	}
+
 	/*** Run length decoding ***/
 
 	/* Load the dungeon data */
@@ -1879,6 +1988,8 @@ static void load_map(int xmin, int ymin, int xmax, int ymax)
 
 				/* Extract field */
 				c_ptr->fld_idx = 0;
+				c_ptr->fld_info = 0;
+				c_ptr->fld_type = 0;
 
 				/* Advance/Wrap */
 				if (++x >= xmax)
@@ -1892,6 +2003,9 @@ static void load_map(int xmin, int ymin, int xmax, int ymax)
 			}
 		}
 	}
+
+	/* Success */
+	return (0);
 }
 
 
@@ -2069,15 +2183,77 @@ static void strip_map(int xmin, int ymin, int xmax, int ymax)
 static s32b wild_x_size;
 static s32b wild_y_size;
 
+/*
+ * Load packed wilderness data (see "save_wild_data()")
+ */
+static errr load_wild_packed(void)
+{
+	int i, j;
+
+	u32b size = (u32b)wild_x_size * (u32b)wild_y_size;
+
+	byte *plane, *ptr;
+
+	wild_done_type *w_ptr;
+
+	/* Load wilderness seed */
+	rd_u32b(&wild_seed);
+
+	/* Get the planes */
+	C_MAKE(plane, size * WILD_SECTION_PLANES, byte);
+
+	if (rd_section(plane, size * WILD_SECTION_PLANES))
+	{
+		FREE(plane);
+		return (-1);
+	}
+
+	/* Load wilderness map */
+	for (i = 0, ptr = plane; i < wild_x_size; i++)
+	{
+		for (j = 0; j < wild_y_size; j++, ptr++)
+		{
+			w_ptr = &wild[j][i].done;
+
+			/* Terrain */
+			w_ptr->wild = ptr[0] | ((u16b)ptr[size] << 8);
+
+			/* Places */
+			w_ptr->place = ptr[size * 2];
+
+			/* Info flag */
+			w_ptr->info = ptr[size * 3];
+
+			/* Monster Gen type */
+			w_ptr->mon_gen = ptr[size * 4];
+
+			/* Monster Probability */
+			w_ptr->mon_prob = ptr[size * 5];
+		}
+	}
+
+	FREE(plane);
+
+	/* Success */
+	return (0);
+}
+
+
 /*
  * Load wilderness data
  */
-static void load_wild_data(void)
+static errr load_wild_data(void)
 {
 	int i, j;
 	u16b tmp_u16b;
 	byte tmp_byte;
 
+	/* Packed savefiles */
+	if (sf_version >= VERSION_PACKED_MAP)
+	{
+		return (load_wild_packed());
+	}
+
 	if (sf_version < 28)
 	{
 		/* Load bounds */
@@ -2137,12 +2313,14 @@ static void load_wild_data(void)
 			}
 		}
 	}
+
+	/* Success */
+	return (0);
 }
 
 /* The version when the format of the wilderness last changed */
 #define VERSION_CHANGE_WILD		48
 
-
 /*
  * Read the dungeon
  *
@@ -2357,7 +2535,7 @@ static errr rd_dungeon(void)
 	else
 	{
 		/* Load wilderness data */
-		load_wild_data();
+		if (load_wild_data()) return (171);
 
 		change_level(p_ptr->depth);
 
@@ -2368,7 +2546,7 @@ static errr rd_dungeon(void)
 			incref_region(cur_region);
 
 			/* Load dungeon map */
-			load_map(0, 0, cur_wid, cur_hgt);
+			if (load_map(0, 0, cur_wid, cur_hgt)) return (172);
 
 			/* Restore the bounds, overwritten in change_level */
 			p_ptr->max_hgt = cur_hgt;
@@ -2379,8 +2557,8 @@ static errr rd_dungeon(void)
 		else
 		{
 			/* Load the wilderness */
-			load_map(p_ptr->min_wid, p_ptr->min_hgt, p_ptr->max_wid,
-					 p_ptr->max_hgt);
+			if (load_map(p_ptr->min_wid, p_ptr->min_hgt, p_ptr->max_wid,
+						 p_ptr->max_hgt)) return (172);
 		}
 	}
 
@@ -2603,6 +2781,12 @@ static errr rd_dungeon(void)
 	}
 
 
+	/* Remember the holes left in the lists */
+	o_free_rebuild();
+	m_free_rebuild();
+	f_free_rebuild();
+
+
 	/*** Success ***/
 
 	/* Regenerate the dungeon for old savefiles and corrupted panic-saves */
@@ -3475,6 +3659,9 @@ errr rd_savefile_new(void)
 	/* Check for errors */
 	if (ferror(fff)) err = -1;
 
+	/* Count the bytes read */
+	file_bytes_read += (huge)MAX(ftell(fff), 0);
+
 	/* Close the file */
 	my_fclose(fff);
 
@@ -454,6 +454,192 @@ int **map_grid;
 static int player_x = 0;
 static int player_y = 0;
 
+/*
+ * When each 16x16 block of the map last changed.
+ *
+ * Each change to a tile gets the next "map_stamp", which is stored
+ * for the block it is in, so the small-scale maps (see display_map())
+ * can tell which parts of themselves are out of date.
+ */
+static u32b *map_grid_stamp;
+static u32b map_stamp = 0;
+
+
+/*
+ * A cached small-scale map of the dungeon (see display_map())
+ *
+ *	- Term and size it was made for
+ *	- Size of the dungeon it shows
+ *	- Scaling factors
+ *	- The "map_stamp" it is up to date with
+ *
+ *	- The attr/chars, terrain attr/chars and priorities of the grids
+ */
+typedef struct small_map_type small_map_type;
+
+struct small_map_type
+{
+	term *t;
+	int wid, hgt;
+
+	int min_wid, min_hgt;
+	int max_wid, max_hgt;
+
+	int xrat, yrat;
+	int xfactor, yfactor;
+
+	u32b stamp;
+
+	byte **ma;
+	char **mc;
+
+	byte **mta;
+	char **mtc;
+
+	byte **mp;
+};
+
+/*
+ * The small-scale maps (one for each window showing one, usually)
+ */
+#define SMALL_MAP_MAX	4
+
+static small_map_type small_map[SMALL_MAP_MAX];
+
+/* The next small-scale map to throw away */
+static int small_map_next = 0;
+
+/*
+ * Location on a small-scale map of a dungeon grid
+ */
+#define SMALL_MAP_X(S, X) \
+	((X) * (S)->xfactor / (S)->xrat + 1)
+
+#define SMALL_MAP_Y(S, Y) \
+	((Y) * (S)->yfactor / (S)->yrat + 1)
+
+
+/*
+ * Allocate the arrays of a small-scale map
+ */
+static void small_map_make(small_map_type *sm, int wid, int hgt)
+{
+	int i;
+
+	sm->wid = wid;
+	sm->hgt = hgt;
+
+	/* Allocate the maps */
+	C_MAKE(sm->ma, (hgt + 2), byte *);
+	C_MAKE(sm->mc, (hgt + 2), char *);
+	C_MAKE(sm->mp, (hgt + 2), byte *);
+
+	C_MAKE(sm->mta, (hgt + 2), byte *);
+	C_MAKE(sm->mtc, (hgt + 2), char *);
+
+	/* Allocate each line map */
+	for (i = 0; i < (hgt + 2); i++)
+	{
+		/* Allocate one row each array */
+		C_MAKE(sm->ma[i], (wid + 2), byte);
+		C_MAKE(sm->mc[i], (wid + 2), char);
+		C_MAKE(sm->mp[i], (wid + 2), byte);
+
+		C_MAKE(sm->mta[i], (wid + 2), byte);
+		C_MAKE(sm->mtc[i], (wid + 2), char);
+	}
+}
+
+
+/*
+ * Free the arrays of a small-scale map
+ */
+static void small_map_free(small_map_type *sm)
+{
+	int i;
+
+	/* Not in use */
+	sm->t = NULL;
+
+	/* Nothing to free */
+	if (!sm->ma) return;
+
+	/* Free each line map */
+	for (i = 0; i < (sm->hgt + 2); i++)
+	{
+		/* Free one row each array */
+		FREE(sm->ma[i]);
+		FREE(sm->mc[i]);
+		FREE(sm->mta[i]);
+		FREE(sm->mtc[i]);
+		FREE(sm->mp[i]);
+	}
+
+	/* Free the maps */
+	FREE(sm->ma);
+	FREE(sm->mc);
+	FREE(sm->mta);
+	FREE(sm->mtc);
+	FREE(sm->mp);
+}
+
+
+/*
+ * Clear part of a small-scale map
+ */
+static void small_map_wipe(small_map_type *sm, int x1, int y1, int x2, int y2)
+{
+	int x, y;
+
+	for (y = y1; y <= y2; ++y)
+	{
+		for (x = x1; x <= x2; ++x)
+		{
+			/* Nothing here */
+			sm->ma[y][x] = TERM_WHITE;
+			sm->mc[y][x] = ' ';
+
+			sm->mta[y][x] = TERM_WHITE;
+			sm->mtc[y][x] = ' ';
+
+			/* No priority */
+			sm->mp[y][x] = 0;
+		}
+	}
+}
+
+
+/*
+ * Forget all the small-scale maps
+ */
+static void forget_small_maps(void)
+{
+	int i;
+
+	for (i = 0; i < SMALL_MAP_MAX; i++)
+	{
+		/* Not in use */
+		small_map[i].t = NULL;
+	}
+}
+
+
+/*
+ * Note that a 16x16 block of the map has changed
+ */
+static void note_map_block(int x, int y)
+{
+	/* Hack -- on overflow, start again */
+	if (!++map_stamp)
+	{
+		(void)C_WIPE(map_grid_stamp, WILD_SIZE * WILD_SIZE, u32b);
+		forget_small_maps();
+		map_stamp = 1;
+	}
+
+	map_grid_stamp[y * WILD_SIZE + x] = map_stamp;
+}
+
 /*
  * Access the player location
  */
@@ -488,6 +674,9 @@ static void clear_map(void)
 		/* Flag that the block isn't used */
 		map_cache_x[i] = -1;
 	}
+
+	/* The small-scale maps are of the old level */
+	forget_small_maps();
 }
 
 /*
@@ -529,6 +718,9 @@ void init_overhead_map(void)
 		C_MAKE(map_grid[i], WILD_SIZE, int);
 	}
 
+	/* When each block last changed */
+	C_MAKE(map_grid_stamp, WILD_SIZE * WILD_SIZE, u32b);
+
 	/* Initialize */
 	clear_map();
 }
@@ -571,6 +763,14 @@ void del_overhead_map(void)
 
 	/* Free the overhead map itself */
 	FREE(map_grid);
+
+	FREE(map_grid_stamp);
+
+	/* Free the small-scale maps */
+	for (i = 0; i < SMALL_MAP_MAX; i++)
+	{
+		small_map_free(&small_map[i]);
+	}
 }
 
 
@@ -597,6 +797,9 @@ static void clear_block(int block)
 	/* Was this used? */
 	if (map_cache_x[block] != -1)
 	{
+		/* The small-scale maps must look at it again */
+		note_map_block(map_cache_x[block], map_cache_y[block]);
+
 		/* Mark map block as unused */
 		map_grid[map_cache_y[block]][map_cache_x[block]] = -1;
 
@@ -727,6 +930,14 @@ static void save_map_location(int x, int y, const term_map *map)
 		}
 	}
 	
+	/* Note changes for the small-scale maps */
+	if ((mb_ptr->a != map->a) || (mb_ptr->c != map->c) ||
+		(mb_ptr->ta != map->ta) || (mb_ptr->tc != map->tc) ||
+		(mb_ptr->priority != map->priority))
+	{
+		note_map_block(x1, y1);
+	}
+
 	/* Save the tile data */
 	mb_ptr->a = map->a;
 	mb_ptr->c = map->c;
@@ -1965,6 +2176,137 @@ static void map_mon_info(monster_type *m_ptr, monster_race *r_ptr, byte *a, char
 }
 
 
+/*
+ * How a terrain glyph is lit
+ */
+#define GLYPH_NORMAL	0
+#define GLYPH_DARK		1
+#define GLYPH_LITE		2
+#define GLYPH_MAX		3
+
+/*
+ * A cached terrain glyph
+ */
+typedef struct glyph_type glyph_type;
+
+struct glyph_type
+{
+	u16b gen;
+
+	byte a;
+	char c;
+	byte ta;
+	char tc;
+};
+
+/*
+ * The terrain glyph cache.
+ *
+ * Working out how a feature looks (with the lighting effects and the
+ * extended terrain information) is the same for every grid with the
+ * same feature and lighting, so it is done once and remembered here.
+ *
+ * An entry is only valid if its "gen" matches glyph_gen, so the whole
+ * cache can be thrown away by bumping glyph_gen.  This has to be done
+ * whenever the feature visuals change: see reset_glyph_cache().
+ */
+static glyph_type feat_glyph[256][GLYPH_MAX];
+static u16b glyph_gen = 1;
+
+
+/*
+ * Forget all the cached glyphs
+ */
+void reset_glyph_cache(void)
+{
+	glyph_gen++;
+
+	/* Wrapped around - really clear the cache */
+	if (!glyph_gen)
+	{
+		(void)C_WIPE(feat_glyph, 256 * GLYPH_MAX, glyph_type);
+		glyph_gen = 1;
+	}
+}
+
+
+/*
+ * Work out the glyph of a feature with the given lighting
+ */
+static glyph_type *feat_glyph_info(byte feat, int lite)
+{
+	glyph_type *g_ptr = &feat_glyph[feat][lite];
+	feature_type *f_ptr;
+
+	byte a;
+	char c;
+
+	/* Already known */
+	if (g_ptr->gen == glyph_gen) return (g_ptr);
+
+	f_ptr = &f_info[feat];
+
+	/* The feats attr and char */
+	a = f_ptr->x_attr;
+	c = f_ptr->x_char;
+
+	if (lite == GLYPH_DARK)
+	{
+		/* If is ascii graphics */
+		if (a < 16)
+		{
+			/* Use darkened colour */
+			a = darking_colours[a];
+		}
+		else if ((use_graphics == GRAPHICS_ADAM_BOLT)
+				 && (f_ptr->flags & FF_USE_TRANS))
+		{
+			/* Use a dark tile */
+			c++;
+		}
+	}
+	else if (lite == GLYPH_LITE)
+	{
+		/* Use the torch effect */
+		if (a < 16)
+		{
+			/* Use bright colour */
+			a = lighting_colours[a];
+		}
+		else if ((use_graphics == GRAPHICS_ADAM_BOLT)
+				 && (f_ptr->flags & FF_USE_TRANS))
+		{
+			/* Use a light tile */
+			c += 2;
+		}
+	}
+
+	g_ptr->a = a;
+	g_ptr->c = c;
+
+	/* Does the feature have "extended terrain" information? */
+	if (f_ptr->w_attr)
+	{
+		/*
+		 * Store extended terrain information. 
+		 * Note hack to get lighting right.
+		 */
+		g_ptr->ta = f_ptr->w_attr + a - f_ptr->x_attr;
+		g_ptr->tc = f_ptr->w_char + c - f_ptr->x_char;
+	}
+	else
+	{
+		g_ptr->ta = a;
+		g_ptr->tc = c;
+	}
+
+	/* Remember it */
+	g_ptr->gen = glyph_gen;
+
+	return (g_ptr);
+}
+
+
 /*
  * Extract the attr/char to display at the given (legal) map location
  *
@@ -2042,6 +2384,8 @@ static void map_info(int x, int y, byte *ap, char *cp, byte *tap, char *tcp)
 
 	field_type *fld_ptr;
 
+	glyph_type *g_ptr;
+
 	/* Get location */
 	cave_type *c_ptr = area(x, y);
 	pcave_type *pc_ptr = parea(x, y);
@@ -2105,12 +2449,6 @@ static void map_info(int x, int y, byte *ap, char *cp, byte *tap, char *tcp)
 			if (lite) map.flags |= MAP_LITE;
 		}
 	
-		/* The feats attr */
-		a = f_ptr->x_attr;
-
-		/* The feats char */
-		c = f_ptr->x_char;
-
 		/*
 		 * Look for lighting effects.
 		 *
@@ -2125,53 +2463,31 @@ static void map_info(int x, int y, byte *ap, char *cp, byte *tap, char *tcp)
 			if (((!(player & (GRID_VIEW))) && view_special_lite)
 				|| !visible)
 			{
-				/* If is ascii graphics */
-				if (a < 16)
-				{
-					/* Use darkened colour */
-					a = darking_colours[a];
-				}
-				else if ((use_graphics == GRAPHICS_ADAM_BOLT)
-						 && (f_ptr->flags & FF_USE_TRANS))
-				{
-					/* Use a dark tile */
-					c++;
-				}
+				/* Darken it */
+				g_ptr = feat_glyph_info(feat, GLYPH_DARK);
 			}
 			else if (lite && view_yellow_lite)
 			{
 				/* Use the torch effect */
-				if (a < 16)
-				{
-					/* Use bright colour */
-					a = lighting_colours[a];
-				}
-				else if ((use_graphics == GRAPHICS_ADAM_BOLT)
-						 && (f_ptr->flags & FF_USE_TRANS))
-				{
-					/* Use a light tile */
-					c += 2;
-				}
+				g_ptr = feat_glyph_info(feat, GLYPH_LITE);
+			}
+			else
+			{
+				g_ptr = feat_glyph_info(feat, GLYPH_NORMAL);
 			}
-		}
-		
-		/* Save the terrain info for the transparency effects */
-
-		/* Does the feature have "extended terrain" information? */
-		if (f_ptr->w_attr)
-		{
-			/*
-			 * Store extended terrain information. 
-			 * Note hack to get lighting right.
-			 */
-			(*tap) = f_ptr->w_attr + a - f_ptr->x_attr;
-			(*tcp) = f_ptr->w_char + c - f_ptr->x_char;
 		}
 		else
 		{
-			(*tap) = a;
-			(*tcp) = c;
+			g_ptr = feat_glyph_info(feat, GLYPH_NORMAL);
 		}
+
+		/* The feats attr and char */
+		a = g_ptr->a;
+		c = g_ptr->c;
+
+		/* Save the terrain info for the transparency effects */
+		(*tap) = g_ptr->ta;
+		(*tcp) = g_ptr->tc;
 	}
 
 
@@ -2393,6 +2709,120 @@ void Term_erase_map(void)
 }
 
 
+/*
+ * Grids on the screen that need to be redrawn.
+ *
+ * One bit per grid of the panel.  Changes that don't draw the grid
+ * straight away mark it here with queue_spot(), so the next redraw
+ * only needs to look at these grids, instead of the whole map.
+ */
+static u32b *map_spots = NULL;
+
+/* Size of the map_spots[] array (words per row, and rows) */
+static int map_spots_wid = 0;
+static int map_spots_hgt = 0;
+
+/* Map redraw statistics */
+u32b map_full_redraws = 0;
+u32b map_spot_redraws = 0;
+u32b map_grids_redrawn = 0;
+
+
+/*
+ * Forget all the queued grids, and fit the array to the panel
+ */
+static void wipe_map_spots(void)
+{
+	int wid = (p_ptr->panel_x2 - p_ptr->panel_x1 + 31) / 32;
+	int hgt = p_ptr->panel_y2 - p_ptr->panel_y1;
+
+	/* The panel has changed size */
+	if ((wid != map_spots_wid) || (hgt != map_spots_hgt))
+	{
+		FREE(map_spots);
+
+		map_spots_wid = wid;
+		map_spots_hgt = hgt;
+
+		C_MAKE(map_spots, wid * hgt, u32b);
+
+		return;
+	}
+
+	(void)C_WIPE(map_spots, wid * hgt, u32b);
+}
+
+
+/*
+ * Note that a map grid needs to be redrawn at the next redraw_stuff()
+ */
+void queue_spot(int x, int y)
+{
+	int dx, dy;
+
+	/* Paranoia */
+	if (!character_dungeon) return;
+
+	/* Only grids on the screen */
+	if (!panel_contains(x, y)) return;
+
+	dx = x - p_ptr->panel_x1;
+	dy = y - p_ptr->panel_y1;
+
+	/* The array does not match the panel - redraw everything */
+	if ((dy >= map_spots_hgt) || ((dx / 32) >= map_spots_wid))
+	{
+		p_ptr->redraw |= (PR_MAP);
+		return;
+	}
+
+	/* Remember the grid */
+	map_spots[dy * map_spots_wid + dx / 32] |= (1UL << (dx % 32));
+
+	/* Redraw the queued grids */
+	p_ptr->redraw |= (PR_MAP_SPOTS);
+}
+
+
+/*
+ * Redraw the queued map grids
+ */
+void prt_map_spots(void)
+{
+	int x, y, i;
+
+	u32b *row;
+
+	/* Count redraws */
+	map_spot_redraws++;
+
+	for (y = 0; y < map_spots_hgt; y++)
+	{
+		row = &map_spots[y * map_spots_wid];
+
+		for (i = 0; i < map_spots_wid; i++)
+		{
+			/* Quickly skip unchanged parts of the row */
+			if (!row[i]) continue;
+
+			for (x = i * 32; row[i]; x++)
+			{
+				if (!(row[i] & (1UL << (x % 32)))) continue;
+
+				/* Redraw it (this clears the bit) */
+				lite_spot(x + p_ptr->panel_x1, y + p_ptr->panel_y1);
+
+				/* Paranoia - grid was not on the screen */
+				row[i] &= ~(1UL << (x % 32));
+
+				/* Count grids */
+				map_grids_redrawn++;
+			}
+		}
+	}
+}
+
+
 /*
  * Prints the map of the dungeon
  *
@@ -2426,6 +2856,12 @@ void prt_map(void)
 
 	/* Hide the cursor */
 	(void)Term_set_cursor(0);
+
+	/* Every grid is about to be redrawn */
+	wipe_map_spots();
+
+	/* Count redraws */
+	map_full_redraws++;
 	
 	/* Get bounds */
 	xmin = p_ptr->panel_x1;
@@ -2459,6 +2895,9 @@ void prt_map(void)
 			{
 				/* Get map info */
 				map_info(x, y, pa, pc, pta, ptc);
+
+				/* Count grids */
+				map_grids_redrawn++;
 			}
 
 			/* Advance */
@@ -2688,6 +3127,184 @@ static int display_map_info(int x, int y, char *c, byte *a, char *tc, byte *ta)
 }
 
 
+/*
+ * Work out part of a small-scale map of the dungeon.
+ *
+ * Every grid of the small-scale map that the dungeon grids from
+ * (x1, y1) to (x2, y2) fall into is worked out again from scratch.
+ */
+static void small_map_update(small_map_type *sm, int x1, int y1, int x2,
+                             int y2)
+{
+	int i, j, x, y;
+
+	byte ta;
+	char tc;
+
+	byte tta;
+	char ttc;
+
+	byte tp;
+
+	/* Stay inside the dungeon */
+	if (x1 < sm->min_wid) x1 = sm->min_wid;
+	if (y1 < sm->min_hgt) y1 = sm->min_hgt;
+	if (x2 >= sm->max_wid) x2 = sm->max_wid - 1;
+	if (y2 >= sm->max_hgt) y2 = sm->max_hgt - 1;
+
+	/* Nothing to do */
+	if ((x1 > x2) || (y1 > y2)) return;
+
+	/* Include every dungeon grid of the small-scale grids */
+	while ((x1 > sm->min_wid) &&
+		   (SMALL_MAP_X(sm, x1 - 1) == SMALL_MAP_X(sm, x1))) x1--;
+	while ((y1 > sm->min_hgt) &&
+		   (SMALL_MAP_Y(sm, y1 - 1) == SMALL_MAP_Y(sm, y1))) y1--;
+	while ((x2 < sm->max_wid - 1) &&
+		   (SMALL_MAP_X(sm, x2 + 1) == SMALL_MAP_X(sm, x2))) x2++;
+	while ((y2 < sm->max_hgt - 1) &&
+		   (SMALL_MAP_Y(sm, y2 + 1) == SMALL_MAP_Y(sm, y2))) y2++;
+
+	/* Forget the old contents */
+	small_map_wipe(sm, SMALL_MAP_X(sm, x1), SMALL_MAP_Y(sm, y1),
+				   SMALL_MAP_X(sm, x2), SMALL_MAP_Y(sm, y2));
+
+	/* Fill in the map of dungeon */
+	for (i = x1; i <= x2; ++i)
+	{
+		for (j = y1; j <= y2; ++j)
+		{
+			/* Location */
+			x = SMALL_MAP_X(sm, i);
+			y = SMALL_MAP_Y(sm, j);
+
+			/* Get priority and symbol */
+			tp = display_map_info(i, j, &tc, &ta, &ttc, &tta);
+
+			/* Save "best" */
+			if (sm->mp[y][x] < tp)
+			{
+				/* Save the char */
+				sm->mc[y][x] = tc;
+
+				/* Save the attr */
+				sm->ma[y][x] = ta;
+
+				/* Save the transparency graphic */
+				sm->mtc[y][x] = ttc;
+				sm->mta[y][x] = tta;
+
+				/* Save priority */
+				sm->mp[y][x] = tp;
+			}
+		}
+	}
+}
+
+
+/*
+ * Get the small-scale map of the dungeon for the active Term,
+ * bringing it up to date.
+ *
+ * The map is kept from one call to the next, and only the 16x16
+ * blocks of the dungeon that have changed since (see "map_stamp")
+ * are worked out again, so the cost depends on how much has changed
+ * and the size of the window, rather than the size of the dungeon.
+ */
+static small_map_type *small_map_get(int wid, int hgt)
+{
+	small_map_type *sm = NULL;
+
+	int i, x, y;
+	int xrat, yrat, xfactor, yfactor;
+
+	/*
+	 * Working the map out can change the overhead map (see
+	 * display_map_info()), so it is only up to date with the
+	 * changes made before we start.
+	 */
+	u32b stamp = map_stamp;
+
+	yrat = p_ptr->max_hgt - p_ptr->min_hgt;
+	xrat = p_ptr->max_wid - p_ptr->min_wid;
+
+	/* Get scaling factors */
+	yfactor = ((yrat / hgt < 4) && (yrat > hgt)) ? 10 : 1;
+	xfactor = ((xrat / wid < 4) && (xrat > wid)) ? 10 : 1;
+
+	yrat = (yrat * yfactor + hgt - 1) / hgt;
+	xrat = (xrat * xfactor + wid - 1) / wid;
+
+	/* Look for the map of this window */
+	for (i = 0; i < SMALL_MAP_MAX; i++)
+	{
+		if ((small_map[i].t == Term) && (small_map[i].wid == wid) &&
+			(small_map[i].hgt == hgt) &&
+			(small_map[i].min_wid == p_ptr->min_wid) &&
+			(small_map[i].min_hgt == p_ptr->min_hgt) &&
+			(small_map[i].max_wid == p_ptr->max_wid) &&
+			(small_map[i].max_hgt == p_ptr->max_hgt))
+		{
+			sm = &small_map[i];
+			break;
+		}
+	}
+
+	/* Bring it up to date */
+	if (sm)
+	{
+		for (y = sm->min_hgt / WILD_BLOCK_SIZE;
+			 y <= (sm->max_hgt - 1) / WILD_BLOCK_SIZE; y++)
+		{
+			for (x = sm->min_wid / WILD_BLOCK_SIZE;
+				 x <= (sm->max_wid - 1) / WILD_BLOCK_SIZE; x++)
+			{
+				/* Unchanged */
+				if (map_grid_stamp[y * WILD_SIZE + x] <= sm->stamp) continue;
+
+				small_map_update(sm, x * WILD_BLOCK_SIZE, y * WILD_BLOCK_SIZE,
+								 x * WILD_BLOCK_SIZE + WILD_BLOCK_SIZE - 1,
+								 y * WILD_BLOCK_SIZE + WILD_BLOCK_SIZE - 1);
+			}
+		}
+
+		sm->stamp = stamp;
+
+		return (sm);
+	}
+
+	/* Throw away the oldest map */
+	sm = &small_map[small_map_next];
+	small_map_next = (small_map_next + 1) % SMALL_MAP_MAX;
+
+	small_map_free(sm);
+
+	/* Make a new one */
+	small_map_make(sm, wid, hgt);
+
+	sm->t = Term;
+
+	sm->min_wid = p_ptr->min_wid;
+	sm->min_hgt = p_ptr->min_hgt;
+	sm->max_wid = p_ptr->max_wid;
+	sm->max_hgt = p_ptr->max_hgt;
+
+	sm->xrat = xrat;
+	sm->yrat = yrat;
+	sm->xfactor = xfactor;
+	sm->yfactor = yfactor;
+
+	/* Work out all of it */
+	small_map_wipe(sm, 0, 0, wid + 1, hgt + 1);
+	small_map_update(sm, sm->min_wid, sm->min_hgt, sm->max_wid - 1,
+					 sm->max_hgt - 1);
+
+	sm->stamp = stamp;
+
+	return (sm);
+}
+
+
 /*
  * Display a "small-scale" map of the dungeon in the active Term
  *
@@ -2721,8 +3338,6 @@ void display_map(int *cx, int *cy)
 	byte tta;
 	char ttc;
 
-	byte tp;
-
 	bool road;
 
 	u16b w_type, w_info, twn;
@@ -2730,14 +3345,14 @@ void display_map(int *cx, int *cy)
 	byte **ma;
 	char **mc;
 
-	byte **mp;
-
 	byte **mta;
 	char **mtc;
 
-	int hgt, wid, yrat, xrat, xfactor, yfactor;
+	int hgt, wid;
 	
 	place_type *pl_ptr;
+
+	small_map_type wild_map, *sm;
 	
 		
 	/* Hack - disable bigtile mode */
@@ -2763,43 +3378,28 @@ void display_map(int *cx, int *cy)
 		return;
 	}
 
-	/* Allocate the maps */
-	C_MAKE(ma, (hgt + 2), byte *);
-	C_MAKE(mc, (hgt + 2), char *);
-	C_MAKE(mp, (hgt + 2), byte *);
-
-	C_MAKE(mta, (hgt + 2), byte *);
-	C_MAKE(mtc, (hgt + 2), char *);
-
-	/* Allocate and wipe each line map */
-	for (i = 0; i < (hgt + 2); i++)
+	if (p_ptr->depth)
 	{
-		/* Allocate one row each array */
-		C_MAKE(ma[i], (wid + 2), byte);
-		C_MAKE(mc[i], (wid + 2), char);
-		C_MAKE(mp[i], (wid + 2), byte);
-
-		C_MAKE(mta[i], (wid + 2), byte);
-		C_MAKE(mtc[i], (wid + 2), char);
+		/* Get the (cached) map of the dungeon */
+		sm = small_map_get(wid, hgt);
 	}
-
-	/* Clear the chars and attributes */
-	for (y = 0; y < hgt + 2; ++y)
+	else
 	{
-		for (x = 0; x < wid + 2; ++x)
-		{
-			/* Nothing here */
-			ma[y][x] = TERM_WHITE;
-			mc[y][x] = ' ';
+		/* The wilderness map is made from scratch */
+		sm = &wild_map;
 
-			mta[y][x] = TERM_WHITE;
-			mtc[y][x] = ' ';
+		(void)WIPE(sm, small_map_type);
 
-			/* No priority */
-			mp[y][x] = 0;
-		}
+		small_map_make(sm, wid, hgt);
+		small_map_wipe(sm, 0, 0, wid + 1, hgt + 1);
 	}
 
+	ma = sm->ma;
+	mc = sm->mc;
+
+	mta = sm->mta;
+	mtc = sm->mtc;
+
 	if (!p_ptr->depth)
 	{
 		/* Plot wilderness */
@@ -2968,50 +3568,9 @@ void display_map(int *cx, int *cy)
 	}
 	else
 	{
-		yrat = p_ptr->max_hgt - p_ptr->min_hgt;
-		xrat = p_ptr->max_wid - p_ptr->min_wid;
-
-		/* Get scaling factors */
-		yfactor = ((yrat / hgt < 4) && (yrat > hgt)) ? 10 : 1;
-		xfactor = ((xrat / wid < 4) && (xrat > wid)) ? 10 : 1;
-
-		yrat = (yrat * yfactor + hgt - 1) / hgt;
-		xrat = (xrat * xfactor + wid - 1) / wid;
-
 		/* Player location in dungeon */
-		(*cy) = py * yfactor / yrat + ROW_MAP;
-		(*cx) = px * xfactor / xrat + 1;
-
-		/* Fill in the map of dungeon */
-		for (i = p_ptr->min_wid; i < p_ptr->max_wid; ++i)
-		{
-			for (j = p_ptr->min_hgt; j < p_ptr->max_hgt; ++j)
-			{
-				/* Location */
-				x = i * xfactor / xrat + 1;
-				y = j * yfactor / yrat + 1;
-
-				/* Get priority and symbol */
-				tp = display_map_info(i, j, &tc, &ta, &ttc, &tta);
-
-				/* Save "best" */
-				if (mp[y][x] < tp)
-				{
-					/* Save the char */
-					mc[y][x] = tc;
-
-					/* Save the attr */
-					ma[y][x] = ta;
-
-					/* Save the transparency graphic */
-					mtc[y][x] = ttc;
-					mta[y][x] = tta;
-
-					/* Save priority */
-					mp[y][x] = tp;
-				}
-			}
-		}
+		(*cy) = SMALL_MAP_Y(sm, py) - 1 + ROW_MAP;
+		(*cx) = SMALL_MAP_X(sm, px);
 	}
 
 	/* Corners */
@@ -3055,23 +3614,8 @@ void display_map(int *cx, int *cy)
 		}
 	}
 
-	/* Free each line map */
-	for (i = 0; i < (hgt + 2); i++)
-	{
-		/* Free one row each array */
-		FREE(ma[i]);
-		FREE(mc[i]);
-		FREE(mta[i]);
-		FREE(mtc[i]);
-		FREE(mp[i]);
-	}
-
-	/* Free the maps */
-	FREE(ma);
-	FREE(mc);
-	FREE(mta);
-	FREE(mtc);
-	FREE(mp);
+	/* Free the wilderness map */
+	if (sm == &wild_map) small_map_free(sm);
 }
 
 
@@ -3099,6 +3643,15 @@ void lite_spot(int x, int y)
 		/* Redraw if on screen */
 		if (panel_contains(x, y))
 		{
+			int dx = x - p_ptr->panel_x1;
+			int dy = y - p_ptr->panel_y1;
+
+			/* The grid is now up to date */
+			if ((dy < map_spots_hgt) && ((dx / 32) < map_spots_wid))
+			{
+				map_spots[dy * map_spots_wid + dx / 32] &= ~(1UL << (dx % 32));
+			}
+
 			/* Real coordinates convert to screen positions */
 			x -= p_ptr->panel_x1 - COL_MAP;
 			y -= p_ptr->panel_y1 - ROW_MAP;
@@ -835,22 +835,15 @@ static errr Term_wipe_gcu(int x, int y, int n)
 
 
 /*
- * Place some text on the screen using an attribute
+ * Place some text on the screen using the current attribute
  */
-static errr Term_text_gcu(int x, int y, int n, byte a, cptr s)
+static void Term_chars_gcu(term_data *td, int x, int y, int n, cptr s)
 {
-	term_data *td = (term_data *)(Term->data);
-
 	int i;
 #ifdef USE_GRAPHICS
 	int pic;
 #endif
 
-#ifdef A_COLOR
-	/* Set the color */
-	if (can_use_color) wattrset(td->win, colortable[a & 0x0F]);
-#endif
-
 	/* Move the cursor */
 	wmove(td->win, y, x);
 
@@ -892,6 +885,69 @@ static errr Term_text_gcu(int x, int y, int n, byte a, cptr s)
 		/* Draw a normal character */
 		waddch(td->win, s[i]);
 	}
+}
+
+
+/*
+ * Place some text on the screen using an attribute
+ */
+static errr Term_text_gcu(int x, int y, int n, byte a, cptr s)
+{
+	term_data *td = (term_data *)(Term->data);
+
+#ifdef A_COLOR
+	/* Set the color */
+	if (can_use_color) wattrset(td->win, colortable[a & 0x0F]);
+#endif
+
+	/* Draw the text */
+	Term_chars_gcu(td, x, y, n, s);
+
+	/* Success */
+	return (0);
+}
+
+
+/*
+ * Draw all the changes made by a refresh
+ *
+ * Hack -- only change the color when we have to.
+ */
+static errr Term_draw_gcu(int n, const term_span *sp)
+{
+	term_data *td = (term_data *)(Term->data);
+
+	int i;
+
+#ifdef A_COLOR
+	/* No color yet */
+	int attr = -1;
+#endif
+
+	for (i = 0; i < n; i++, sp++)
+	{
+		/* Erase some grids */
+		if (sp->kind == TERM_SPAN_WIPE)
+		{
+			(void)Term_wipe_gcu(sp->x, sp->y, sp->n);
+			continue;
+		}
+
+		/* Paranoia -- we never ask for "Term_pict()" */
+		if (sp->kind != TERM_SPAN_TEXT) continue;
+
+#ifdef A_COLOR
+		/* Set the color */
+		if (can_use_color && (attr != (sp->a & 0x0F)))
+		{
+			attr = sp->a & 0x0F;
+			wattrset(td->win, colortable[attr]);
+		}
+#endif
+
+		/* Draw the text */
+		Term_chars_gcu(td, sp->x, sp->y, sp->n, sp->cp);
+	}
 
 	/* Success */
 	return (0);
@@ -936,6 +992,7 @@ static errr term_data_init_gcu(term_data *td, int rows, int cols, int y, int x)
 	t->wipe_hook = Term_wipe_gcu;
 	t->curs_hook = Term_curs_gcu;
 	t->xtra_hook = Term_xtra_gcu;
+	t->draw_hook = Term_draw_gcu;
 
 	/* Save the data */
 	t->data = td;
@@ -2529,6 +2529,103 @@ static errr Term_pict_x11(int ox, int oy, int n, const byte *ap, const char *cp,
 #endif /* USE_GRAPHICS */
 
 
+/*
+ * Number of rectangles erased by one request in "Term_draw_x11()"
+ */
+#define X11_RECT_MAX	64
+
+
+/*
+ * Draw all the changes made by a refresh
+ *
+ * Everything to be erased (including the grids under the new text)
+ * is filled in with a single request, and then the text is drawn one
+ * color at a time, so a screen full of changes only needs a few
+ * requests (and GC changes) rather than a couple for every stripe.
+ */
+static errr Term_draw_x11(int n, const term_span *sp)
+{
+	XRectangle rect[X11_RECT_MAX];
+	int num = 0;
+
+	bool used[256];
+
+	int i, a;
+	int x1, y1, x2, y2;
+
+	/* No colors yet */
+	(void)C_WIPE(used, 256, bool);
+
+	/* Collect the areas to erase */
+	for (i = 0; i < n; i++)
+	{
+		/* Pictures cover their own grids */
+		if (sp[i].kind == TERM_SPAN_PICT) continue;
+
+		/* Remember the colors */
+		if (sp[i].kind == TERM_SPAN_TEXT) used[sp[i].a] = TRUE;
+
+		/* Find the dimensions */
+		square_to_pixel(&x1, &y1, sp[i].x, sp[i].y);
+		square_to_pixel(&x2, &y2, sp[i].x + sp[i].n, sp[i].y);
+
+		rect[num].x = x1;
+		rect[num].y = y1;
+		rect[num].width = x2 - x1;
+		rect[num].height = Infofnt->hgt;
+
+		/* Erase a full buffer */
+		if (++num == X11_RECT_MAX)
+		{
+			XFillRectangles(Metadpy->dpy, Infowin->win, clr[TERM_DARK]->gc,
+							rect, num);
+			num = 0;
+		}
+	}
+
+	/* Erase the rest (use black) */
+	if (num)
+	{
+		XFillRectangles(Metadpy->dpy, Infowin->win, clr[TERM_DARK]->gc,
+						rect, num);
+	}
+
+	/* Draw the text, one color at a time */
+	for (a = 0; a < 256; a++)
+	{
+		if (!used[a]) continue;
+
+		Infoclr_set(clr[a]);
+
+		for (i = 0; i < n; i++)
+		{
+			if ((sp[i].kind != TERM_SPAN_TEXT) || (sp[i].a != a)) continue;
+
+			Infofnt_text_std(sp[i].x, sp[i].y, sp[i].cp, sp[i].n);
+		}
+	}
+
+#ifdef USE_GRAPHICS
+
+	/* Draw the pictures */
+	for (i = 0; i < n; i++)
+	{
+		if (sp[i].kind != TERM_SPAN_PICT) continue;
+
+		(void)Term_pict_x11(sp[i].x, sp[i].y, sp[i].n, sp[i].ap, sp[i].cp,
+							sp[i].tap, sp[i].tcp);
+	}
+
+#endif /* USE_GRAPHICS */
+
+	/* Redraw the selection if any, as it may have been obscured. (later) */
+	x11_selection->drawn = FALSE;
+
+	/* Success */
+	return (0);
+}
+
+
 
 /*
  * Initialize a term_data
@@ -2720,6 +2817,7 @@ static errr term_data_init(term_data *td, int i)
 	t->curs_hook = Term_curs_x11;
 	t->wipe_hook = Term_wipe_x11;
 	t->text_hook = Term_text_x11;
+	t->draw_hook = Term_draw_x11;
 
 	/* Save the data */
 	t->data = td;
@@ -329,6 +329,74 @@ static void change_path(cptr info)
 	}
 }
 
+/*
+ * The screen recording to replay (see "-y"), and how many times
+ */
+static cptr replay_file = NULL;
+static int replay_num = 1;
+
+/*
+ * What the replay found (printed once the display has gone)
+ */
+static char replay_report[160];
+
+
+/*
+ * Print the result of the replay
+ */
+static void replay_dump(void)
+{
+	if (replay_report[0]) puts(replay_report);
+}
+
+
+/*
+ * Replay a screen recording (see Term_record()) through the main term
+ * as fast as possible, then quit.
+ *
+ * No game is loaded, so this times the display code on its own.
+ */
+static void replay_screen(void)
+{
+	FILE *fff;
+
+	int i, frames = 0;
+	errr err = 0;
+
+	clock_t start, ticks;
+
+	fff = my_fopen(replay_file, "rb");
+
+	if (!fff) quit_fmt("Cannot open '%s'", replay_file);
+
+	start = clock();
+
+	for (i = 0; (i < replay_num) && !err; i++)
+	{
+		/* Start again */
+		rewind(fff);
+
+		err = Term_replay(fff, &frames);
+	}
+
+	ticks = clock() - start;
+
+	my_fclose(fff);
+
+	if (err) quit_fmt("The recording '%s' is corrupt", replay_file);
+
+	/* Report it after the display is shut down */
+	strnfmt(replay_report, sizeof(replay_report),
+			"Replayed %d frames in %ld ms of processor time (%ld per second).",
+			frames, (long)(ticks * 1000 / CLOCKS_PER_SEC),
+			ticks ? (long)(frames * (long)CLOCKS_PER_SEC / ticks) : 0L);
+
+	(void)atexit(replay_dump);
+
+	quit(NULL);
+}
+
+
 /*
  * The default message to print when we get bad input.
  */
@@ -349,6 +417,11 @@ static void game_usage(void)
 	puts("  -M       Request monochrome mode");
 	puts("  -s<num>  Show <num> high scores (default 10)");
 	puts("  -u<who>  Use your <who> savefile");
+	puts("  -p       Time the start up, print a report and quit");
+	puts("  -p<file> Also write the report to <file> as JSON");
+	puts("  -b<file> Fail if the start up is over the budgets in <file>");
+	puts("  -y<file> Replay a screen recording (no game is loaded) and quit");
+	puts("  -Y<num>  Replay it <num> times (default 1)");
 #ifdef FIXED_PATHS
 	puts("  -du=<dir>  Define user dir path");
 #else /* FIXED_PATHS */
@@ -529,6 +602,24 @@ int main(int argc, char *argv[])
 				break;
 			}
 
+			case 'p':
+			case 'P':
+			{
+				arg_profile = TRUE;
+				if (argv[i][2]) arg_profile_json = &argv[i][2];
+				break;
+			}
+
+			case 'b':
+			case 'B':
+			{
+				if (!argv[i][2]) game_usage();
+
+				arg_profile = TRUE;
+				arg_profile_budget = &argv[i][2];
+				break;
+			}
+
 			case 'd':
 			case 'D':
 			{
@@ -536,6 +627,20 @@ int main(int argc, char *argv[])
 				break;
 			}
 
+			case 'y':
+			{
+				if (!argv[i][2]) game_usage();
+				replay_file = &argv[i][2];
+				break;
+			}
+
+			case 'Y':
+			{
+				replay_num = atoi(&argv[i][2]);
+				if (replay_num <= 0) replay_num = 1;
+				break;
+			}
+
 			case '-':
 			{
 				argv[i] = argv[0];
@@ -561,6 +666,9 @@ int main(int argc, char *argv[])
 	}
 
 
+	/* Print the start up report as the game exits */
+	if (arg_profile) (void)atexit(startup_dump);
+
 	/* Process the player name */
 	process_player_name(TRUE);
 
@@ -587,6 +695,9 @@ int main(int argc, char *argv[])
 	/* Make sure we have a display! */
 	if (!done) quit("Unable to prepare any 'display module'!");
 
+	/* Hack -- If requested, replay a screen recording and quit */
+	if (replay_file) replay_screen();
+
 	/* Gtk and Tk initialise earlier */
 	if (!(streq(ANGBAND_SYS, "gtk") || streq(ANGBAND_SYS, "tnb")))
 	{
@@ -597,8 +708,8 @@ int main(int argc, char *argv[])
 	/* Hack -- If requested, display scores and quit */
 	if (show_score > 0) display_scores(0, show_score);
 
-	/* Wait for response */
-	pause_line(23);
+	/* Wait for response (unless timing the start up) */
+	if (!arg_profile) pause_line(23);
 
 	/* Play the game */
 	play_game(new_game);
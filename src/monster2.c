@@ -78,6 +78,56 @@ cptr funny_comments[MAX_SAN_COMMENT] =
 	"Far out!"
 };
 
+/*
+ * The dead entries in the monster list.
+ *
+ * A stack of the indexes of wiped monsters, so that m_pop() does not
+ * have to search the list for a hole.  Stale entries are skipped when
+ * they are popped, and the stack is rebuilt by compact_monsters(), by
+ * rd_dungeon() and by m_pop() before it gives up.
+ */
+static s16b *m_free = NULL;
+static s16b m_free_num = 0;
+
+
+/*
+ * Put a (wiped) monster on the free stack
+ */
+static void m_push(int m_idx)
+{
+	/* Paranoia */
+	if ((m_idx < 1) || (m_idx >= m_max)) return;
+
+	/* Make the stack */
+	if (!m_free) C_MAKE(m_free, z_info->m_max, s16b);
+
+	/* Paranoia - a full stack only loses the hole until the next rebuild */
+	if (m_free_num >= z_info->m_max) return;
+
+	m_free[m_free_num++] = m_idx;
+}
+
+
+/*
+ * Rebuild the free stack from the monster list
+ */
+void m_free_rebuild(void)
+{
+	int i;
+
+	/* Make the stack */
+	if (!m_free) C_MAKE(m_free, z_info->m_max, s16b);
+
+	m_free_num = 0;
+
+	/* Push the highest holes first, so the lowest are used first */
+	for (i = m_max - 1; i >= 1; i--)
+	{
+		if (!m_list[i].r_idx) m_free[m_free_num++] = i;
+	}
+}
+
+
 /*
  * Delete a monster by index.
  *
@@ -133,6 +183,9 @@ void delete_monster_idx(int i)
 	/* Wipe the Monster */
 	(void)WIPE(m_ptr, monster_type);
 
+	/* Recycle the monster */
+	m_push(i);
+
 	/* Count monsters */
 	m_cnt--;
 
@@ -212,12 +265,17 @@ static void compact_monsters_aux(int i1, int i2)
  *
  * After "compacting" (if needed), we "reorder" the monsters into a more
  * compact order, and we reset the allocation info, and the "live" array.
+ *
+ * m_pop() does not need this to find room, so it is only called when
+ * the list is nearly full, or has become mostly holes.
  */
 void compact_monsters(int size)
 {
 	int i, num, cnt;
 	int cur_lev, cur_dis, chance;
 
+	bool changed = FALSE;
+
 	/* Message (only if compacting) */
 	if (size) msgf("Compacting monsters...");
 
@@ -287,7 +345,16 @@ void compact_monsters(int size)
 
 		/* Compress "m_max" */
 		m_max--;
+
+		/* Something changed */
+		changed = TRUE;
 	}
+
+	/* Rebuild the free stack (this also forgets any stale entries) */
+	m_free_rebuild();
+
+	/* Count compactions (only if the list actually changed) */
+	if (changed) m_compacted++;
 }
 
 
@@ -339,6 +406,9 @@ void wipe_m_list(void)
 	/* Reset "m_cnt" */
 	m_cnt = 0;
 
+	/* Forget the holes */
+	m_free_num = 0;
+
 	/* Hack -- reset "reproducer" count */
 	num_repro = 0;
 
@@ -385,6 +455,11 @@ void wipe_monsters(int rg_idx)
  * Acquires and returns the index of a "free" monster.
  *
  * This routine should almost never fail, but it *can* happen.
+ *
+ * The list grows until it is full, and only then are dead monsters
+ * reused.  So a new monster always comes after the monsters that are
+ * already there, and process_monsters() (which works down the list)
+ * does not move it in the game turn it was made.
  */
 s16b m_pop(void)
 {
@@ -408,15 +483,12 @@ s16b m_pop(void)
 
 
 	/* Recycle dead monsters */
-	for (i = 1; i < m_max; i++)
+	while (m_free_num)
 	{
-		monster_type *m_ptr;
+		i = m_free[--m_free_num];
 
-		/* Acquire monster */
-		m_ptr = &m_list[i];
-
-		/* Skip live monsters */
-		if (m_ptr->r_idx) continue;
+		/* Skip stale entries */
+		if ((i >= m_max) || m_list[i].r_idx) continue;
 
 		/* Count monsters */
 		m_cnt++;
@@ -425,6 +497,11 @@ s16b m_pop(void)
 		return (i);
 	}
 
+	/* Look for holes the free stack has lost track of */
+	m_free_rebuild();
+
+	/* Found one */
+	if (m_free_num) return (m_pop());
 
 	/* Warn the player (except during dungeon creation) */
 	if (character_dungeon) msgf("Too many monsters!");
@@ -434,10 +511,78 @@ s16b m_pop(void)
 }
 
 
+/*
+ * The running totals in "alloc_race_cum" need to be rebuilt
+ */
+static bool alloc_race_dirty = TRUE;
+
+/*
+ * The number of entries in "alloc_race_check"
+ */
+static int alloc_race_check_num = 0;
+
+
+/*
+ * Forget the running totals of the "monster allocation table"
+ *
+ * This must be called when a race may have become a questor.
+ */
+void get_mon_num_forget(void)
+{
+	alloc_race_dirty = TRUE;
+}
+
+
+/*
+ * The number of remembered "monster restrictions"
+ */
+#define MON_PREP_MAX	16
+
+typedef struct mon_prep_type mon_prep_type;
+
+/*
+ * A remembered "monster restriction", and the "prob2" values it gave
+ */
+struct mon_prep_type
+{
+	monster_hook_type hook;	/* The restriction */
+	u32b key;	/* State the restriction depends on */
+
+	byte silly;	/* The "silly_monsters" option at the time */
+	bool valid;	/* The entry is in use */
+
+	u32b used;	/* Time of last use */
+
+	byte *prob;	/* The "prob2" values */
+};
+
+static mon_prep_type mon_prep[MON_PREP_MAX];
+
+static u32b mon_prep_tick = 0;
+
+
+/*
+ * Forget the remembered "monster restrictions"
+ *
+ * This must be called when the "monster allocation table" is rebuilt.
+ */
+void get_mon_num_prep_forget(void)
+{
+	int i;
+
+	for (i = 0; i < MON_PREP_MAX; i++)
+	{
+		FREE(mon_prep[i].prob);
+
+		(void)WIPE(&mon_prep[i], mon_prep_type);
+	}
+}
+
+
 /*
  * Apply a "monster restriction function" to the "monster allocation table"
  */
-void get_mon_num_prep(monster_hook_type monster_hook)
+static void get_mon_num_prep_aux(monster_hook_type monster_hook)
 {
 	int i;
 
@@ -469,11 +614,98 @@ void get_mon_num_prep(monster_hook_type monster_hook)
 		}
 	}
 
+	/* The totals have changed */
+	alloc_race_dirty = TRUE;
+
 	/* Success */
 	return;
 }
 
 
+/*
+ * Apply a "monster restriction function", remembering the result
+ *
+ * The "key" must describe everything the restriction depends on,
+ * other than the race itself (the symbol of a pit, the summon type
+ * and so on).  Asking again for the same restriction and key just
+ * copies the old "prob2" values back, without calling the hook.
+ */
+void get_mon_num_prep_key(monster_hook_type monster_hook, u32b key)
+{
+	mon_prep_type *mp_ptr = NULL;
+
+	int i;
+
+	/* Look for the restriction */
+	for (i = 0; i < MON_PREP_MAX; i++)
+	{
+		mon_prep_type *tmp_ptr = &mon_prep[i];
+
+		if (tmp_ptr->valid && (tmp_ptr->hook == monster_hook) &&
+			(tmp_ptr->key == key) && (tmp_ptr->silly == silly_monsters))
+		{
+			/* Restore the old result */
+			for (i = 0; i < alloc_race_size; i++)
+			{
+				alloc_race_table[i].prob2 = tmp_ptr->prob[i];
+			}
+
+			/* The totals have changed */
+			alloc_race_dirty = TRUE;
+
+			/* Recently used */
+			tmp_ptr->used = ++mon_prep_tick;
+
+			return;
+		}
+
+		/* Remember an empty or the least recently used entry */
+		if (!mp_ptr || (mp_ptr->valid &&
+			(!tmp_ptr->valid || (tmp_ptr->used < mp_ptr->used))))
+		{
+			mp_ptr = tmp_ptr;
+		}
+	}
+
+	/* Apply the restriction */
+	get_mon_num_prep_aux(monster_hook);
+
+	/* Make room for the result */
+	if (!mp_ptr->prob) C_MAKE(mp_ptr->prob, alloc_race_size, byte);
+
+	/* Remember the result */
+	for (i = 0; i < alloc_race_size; i++)
+	{
+		mp_ptr->prob[i] = alloc_race_table[i].prob2;
+	}
+
+	mp_ptr->hook = monster_hook;
+	mp_ptr->key = key;
+	mp_ptr->silly = silly_monsters;
+	mp_ptr->valid = TRUE;
+	mp_ptr->used = ++mon_prep_tick;
+}
+
+
+/*
+ * Apply a "monster restriction function" to the "monster allocation table"
+ *
+ * The hooks may depend on the state of the game, so only the common
+ * "no restriction" case is remembered here.
+ */
+void get_mon_num_prep(monster_hook_type monster_hook)
+{
+	if (monster_hook)
+	{
+		get_mon_num_prep_aux(monster_hook);
+	}
+	else
+	{
+		get_mon_num_prep_key(NULL, 0);
+	}
+}
+
+
 /*
  * Are we allowed to place monsters of this race on this square?
  */
@@ -715,18 +947,90 @@ static int filter_mon_loc(int x, int y)
 		/* The level of the monsters */
 		level = base_level();
 	}
-	
+
+	/* The totals have changed */
+	alloc_race_dirty = TRUE;
+
 	return (level);
 }
 
 
+/*
+ * Can a monster of this race not be chosen right now?
+ */
+static bool alloc_race_skip(const monster_race *r_ptr)
+{
+	/* Hack -- "unique" monsters must be "unique" */
+	if ((FLAG(r_ptr, RF_UNIQUE) || FLAG(r_ptr, RF_UNIQUE_7))
+		&& (r_ptr->cur_num >= r_ptr->max_num))
+	{
+		return (TRUE);
+	}
+
+	/* Hack -- don't create questors */
+	if (FLAG(r_ptr, RF_QUESTOR)) return (TRUE);
+
+	/* Depth Monsters never appear out of depth */
+	if (FLAG(r_ptr, RF_FORCE_DEPTH)
+		&& (r_ptr->level > p_ptr->depth))
+	{
+		return (TRUE);
+	}
+
+	return (FALSE);
+}
+
+
+/*
+ * Rebuild the running totals of the "monster allocation table"
+ *
+ * The races that alloc_race_skip() may reject depend on the state
+ * of the game, so they are not taken out of the totals here.  They
+ * are listed instead, so get_mon_num() can check just them.
+ */
+static void alloc_race_build(void)
+{
+	int i;
+
+	alloc_entry *table = alloc_race_table;
+	s32b *cum = alloc_race_cum;
+
+	/* Start the running total */
+	cum[0] = 0;
+
+	/* No entries to check */
+	alloc_race_check_num = 0;
+
+	for (i = 0; i < alloc_race_size; i++)
+	{
+		monster_race *r_ptr = &r_info[table[i].index];
+
+		/* Keep a running total */
+		cum[i + 1] = cum[i] + table[i].prob2;
+
+		/* Ignore entries that cannot be chosen anyway */
+		if (!table[i].prob2) continue;
+
+		/* Remember entries that may be rejected */
+		if (FLAG(r_ptr, RF_UNIQUE) || FLAG(r_ptr, RF_UNIQUE_7) ||
+			FLAG(r_ptr, RF_QUESTOR) || FLAG(r_ptr, RF_FORCE_DEPTH))
+		{
+			alloc_race_check[alloc_race_check_num++] = i;
+		}
+	}
+
+	/* Done */
+	alloc_race_dirty = FALSE;
+}
+
+
 /*
  * Choose a monster race that seems "appropriate" to the given level
  *
- * This function uses the "prob2" field of the "monster allocation table",
- * and various local information, to calculate the "prob3" field of the
- * same table, which is then used to choose an "appropriate" monster, in
- * a relatively efficient manner.
+ * This function uses the running totals of the "prob2" field of the
+ * "monster allocation table" to choose an "appropriate" monster with a
+ * binary search.  Only the few races that may be rejected right now
+ * (see alloc_race_skip()) are looked at one by one.
  *
  * Note that "town" monsters will *only* be created in the town, and
  * "normal" monsters will *never* be created in the town, unless the
@@ -744,16 +1048,14 @@ static int filter_mon_loc(int x, int y)
  */
 s16b get_mon_num(int level)
 {
-	int i, p;
+	int i, j, p, hi, lo;
 
-	int r_idx;
-
-	long value1, value2, total;
-
-	monster_race *r_ptr;
+	long value1, value2, total, skip;
 
 	alloc_entry *table = alloc_race_table;
 
+	s32b *cum = alloc_race_cum;
+
 
 	/* Boost the level */
 	if (level > 0)
@@ -787,51 +1089,31 @@ s16b get_mon_num(int level)
 	}
 
 
-	/* Reset total */
-	total = 0L;
-
-	/* Process probabilities */
-	for (i = 0; i < alloc_race_size; i++)
-	{
-		/* Monsters are sorted by depth */
-		if (table[i].level > level) break;
+	/* Get the running totals */
+	if (alloc_race_dirty) alloc_race_build();
 
-		/* Default */
-		table[i].prob3 = 0;
+	/* Monsters are sorted by depth */
+	hi = alloc_level_index(table, alloc_race_size, level);
 
-		/* Access the "r_idx" of the chosen monster */
-		r_idx = table[i].index;
+	/* Take out the races that may not be chosen */
+	skip = 0L;
 
-		/* Access the actual race */
-		r_ptr = &r_info[r_idx];
-
-		/* Hack -- "unique" monsters must be "unique" */
-		if ((FLAG(r_ptr, RF_UNIQUE) || FLAG(r_ptr, RF_UNIQUE_7))
-			&& (r_ptr->cur_num >= r_ptr->max_num))
-		{
-			continue;
-		}
+	for (j = 0; j < alloc_race_check_num; j++)
+	{
+		i = alloc_race_check[j];
 
-		/* Hack -- don't create questors */
-		if (FLAG(r_ptr, RF_QUESTOR))
-		{
-			continue;
-		}
+		/* The list is sorted too */
+		if (i >= hi) break;
 
-		/* Depth Monsters never appear out of depth */
-		if (FLAG(r_ptr, RF_FORCE_DEPTH)
-			&& (r_ptr->level > p_ptr->depth))
+		if (alloc_race_skip(&r_info[table[i].index]))
 		{
-			continue;
+			skip += table[i].prob2;
 		}
-
-		/* Accept */
-		table[i].prob3 = table[i].prob2;
-
-		/* Total */
-		total += table[i].prob3;
 	}
 
+	/* Total */
+	total = cum[hi] - skip;
+
 	/* No legal monsters */
 	if (total <= 0) return (0);
 
@@ -868,19 +1150,32 @@ s16b get_mon_num(int level)
 		}
 	}
 
-	/* Find the monster */
-	for (i = 0; i < alloc_race_size; i++)
+	/* Find the monster, stepping over the rejected races */
+	lo = 0;
+	skip = 0L;
+
+	for (j = 0; j < alloc_race_check_num; j++)
 	{
-		/* Found the entry */
-		if (value1 < table[i].prob3)
-		{
-			return (table[i].index);
-		}
+		i = alloc_race_check[j];
+
+		if (i >= hi) break;
+
+		if (!alloc_race_skip(&r_info[table[i].index])) continue;
+
+		/* Found it before this race? */
+		if (cum[i] - skip > value1) break;
 
-		/* Decrement */
-		value1 -= table[i].prob3;
+		/* Step over this race */
+		skip += table[i].prob2;
+		lo = i + 1;
 	}
 
+	/* Search the remaining range */
+	i = alloc_prob_index(cum, lo, hi, value1 + skip);
+
+	/* Found the entry */
+	if (i < hi) return (table[i].index);
+
 	msgf("Aborting - Could not generate a monster!!!! %d", total);
 
 	/* Result */
@@ -2130,7 +2425,7 @@ monster_type *place_monster_aux(int x, int y, int r_idx, bool slp, bool grp,
 			if (!cave_empty_grid(c_ptr)) continue;
 
 			/* Prepare allocation table */
-			get_mon_num_prep(place_monster_okay);
+			get_mon_num_prep_key(place_monster_okay, place_monster_idx);
 			
 			/* Default to filtering out monsters not normally on this dungeon */
 			if (!summon)
@@ -2598,6 +2893,46 @@ static bool summon_specific_okay(int r_idx)
 }
 
 
+/*
+ * Describe the state used by summon_specific_okay()
+ */
+static u32b summon_specific_key(void)
+{
+	u32b key = summon_specific_type;
+
+	/* Kin of the summoner */
+	if (summon_specific_type == SUMMON_KIN)
+	{
+		key |= (u32b)((byte)summon_kin_type) << 16;
+	}
+
+	/* The summoner decides the allowed alignments */
+	if (summon_specific_who > 0)
+	{
+		monster_type *m_ptr = &m_list[summon_specific_who];
+		monster_race *s_ptr = &r_info[m_ptr->r_idx];
+
+		key |= 0x0100;
+
+		if (FLAG(s_ptr, RF_GOOD)) key |= 0x0200;
+		if (FLAG(s_ptr, RF_EVIL)) key |= 0x0400;
+
+		if (is_hostile(m_ptr) != summon_specific_hostile) key |= 0x0800;
+	}
+
+	/* Use the player's alignment */
+	else if (summon_specific_who < 0)
+	{
+		key |= 0x1000;
+
+		if (p_ptr->align < 0) key |= 0x2000;
+		if (p_ptr->align > 0) key |= 0x4000;
+	}
+
+	return (key);
+}
+
+
 /*
  * Place a monster (of the specified "type") near the given
  * location.  Return TRUE if a monster was actually summoned.
@@ -2676,7 +3011,7 @@ bool summon_specific(int who, int x1, int y1, int req_lev, int type, bool group,
 	summon_specific_hostile = (!friendly && !pet);
 
 	/* Prepare allocation table */
-	get_mon_num_prep(summon_specific_okay);
+	get_mon_num_prep_key(summon_specific_okay, summon_specific_key());
 
 	/* Pick a monster, using the level calculation */
 	r_idx = get_mon_num((base_level() + req_lev) / 2 + 5);
@@ -122,6 +122,12 @@ errr init_object_alloc(void)
 		KILL(alloc_kind_table);
 	}
 
+	/* Free the old running totals (if they exist) */
+	if (alloc_kind_cum)
+	{
+		KILL(alloc_kind_cum);
+	}
+
 	/* Size of "alloc_kind_table" */
 	alloc_kind_size = 0;
 
@@ -161,6 +167,9 @@ errr init_object_alloc(void)
 	/* Allocate the alloc_kind_table */
 	C_MAKE(alloc_kind_table, alloc_kind_size, alloc_entry);
 
+	/* Allocate the running totals */
+	C_MAKE(alloc_kind_cum, alloc_kind_size + 1, s32b);
+
 	/* Access the table entry */
 	table = alloc_kind_table;
 
@@ -199,6 +208,10 @@ errr init_object_alloc(void)
 		}
 	}
 
+	/* Forget the old restrictions, and get the running totals */
+	get_obj_num_prep_forget();
+	get_obj_num_prep(NULL);
+
 	/* Clear the temp arrays */
 	(void)C_WIPE(aux, MAX_DEPTH, s16b);
 	(void)C_WIPE(num, MAX_DEPTH, s16b);
@@ -94,6 +94,9 @@ void reset_visuals(void)
 	fake_monochrome = (!use_graphics
 					   || streq(ANGBAND_SYS, "ibm")) ? TRUE : FALSE;
 
+	/* Forget the old terrain glyphs */
+	reset_glyph_cache();
+
 	/* Fields have to notice the change of visuals. */
 	init_fields();
 	
@@ -1278,27 +1281,91 @@ bool item_tester_hook_tval(const object_type *o_ptr, byte tval)
 }
 
 
+/*
+ * The groups each "tval" belongs to (see TVG_* in defines.h)
+ */
+static u16b tval_group[256];
+
+/*
+ * Has the table above been filled in?
+ */
+static bool tval_group_init = FALSE;
+
+
+/*
+ * Add a list of tvals (ending with zero) to a group
+ */
+static void tval_group_add(u16b group, const byte *tvals)
+{
+	for (; *tvals; tvals++) tval_group[*tvals] |= group;
+}
+
+
+/*
+ * Find the groups that a tval belongs to.
+ *
+ * The item tester hooks that only look at the "tval" are called
+ * for every item in every list of objects that is drawn, so they
+ * are done as a simple lookup.
+ */
+u16b tval_groups(byte tval)
+{
+	static const byte weapon[] = {TV_SWORD, TV_HAFTED, TV_POLEARM,
+		TV_DIGGING, TV_BOW, TV_BOLT, TV_ARROW, TV_SHOT, 0};
+	static const byte melee[] = {TV_SWORD, TV_HAFTED, TV_POLEARM,
+		TV_DIGGING, 0};
+	static const byte nonsword[] = {TV_HAFTED, TV_POLEARM, 0};
+	static const byte ammo[] = {TV_SHOT, TV_ARROW, TV_BOLT, 0};
+	static const byte fletcher[] = {TV_SHOT, TV_ARROW, TV_BOLT, TV_BOW, 0};
+	static const byte armour[] = {TV_DRAG_ARMOR, TV_HARD_ARMOR,
+		TV_SOFT_ARMOR, TV_SHIELD, TV_CLOAK, TV_CROWN, TV_HELM, TV_BOOTS,
+		TV_GLOVES, 0};
+	static const byte soft[] = {TV_SOFT_ARMOR, TV_CLOAK, TV_BOOTS,
+		TV_GLOVES, 0};
+	static const byte hard[] = {TV_DRAG_ARMOR, TV_HARD_ARMOR, TV_SHIELD,
+		TV_CROWN, TV_HELM, 0};
+	static const byte helm[] = {TV_CROWN, TV_HELM, 0};
+	static const byte pure_hard[] = {TV_DRAG_ARMOR, TV_HARD_ARMOR, 0};
+	static const byte weapon_armour[] = {TV_SWORD, TV_HAFTED, TV_POLEARM,
+		TV_BOW, TV_DRAG_ARMOR, TV_HARD_ARMOR, TV_SOFT_ARMOR, TV_SHIELD,
+		TV_CLOAK, TV_CROWN, TV_HELM, TV_BOOTS, TV_GLOVES, 0};
+	static const byte recharge[] = {TV_STAFF, TV_WAND, TV_ROD, 0};
+	static const byte jewel[] = {TV_RING, TV_AMULET, 0};
+	static const byte book[] = {TV_SORCERY_BOOK, TV_NATURE_BOOK,
+		TV_CHAOS_BOOK, TV_DEATH_BOOK, TV_TRUMP_BOOK, TV_ARCANE_BOOK,
+		TV_LIFE_BOOK, 0};
+
+	/* Fill in the table the first time */
+	if (!tval_group_init)
+	{
+		tval_group_add(TVG_WEAPON, weapon);
+		tval_group_add(TVG_MELEE, melee);
+		tval_group_add(TVG_NONSWORD, nonsword);
+		tval_group_add(TVG_AMMO, ammo);
+		tval_group_add(TVG_FLETCHER, fletcher);
+		tval_group_add(TVG_ARMOUR, armour);
+		tval_group_add(TVG_SOFT_ARMOUR, soft);
+		tval_group_add(TVG_HARD_ARMOUR, hard);
+		tval_group_add(TVG_HELM, helm);
+		tval_group_add(TVG_PURE_HARD, pure_hard);
+		tval_group_add(TVG_WEAPON_ARMOUR, weapon_armour);
+		tval_group_add(TVG_RECHARGE, recharge);
+		tval_group_add(TVG_JEWEL, jewel);
+		tval_group_add(TVG_BOOK, book);
+
+		tval_group_init = TRUE;
+	}
+
+	return (tval_group[tval]);
+}
+
+
 /*
  * Hook to specify "weapon"
  */
 bool item_tester_hook_weapon(const object_type *o_ptr)
 {
-	switch (o_ptr->tval)
-	{
-		case TV_SWORD:
-		case TV_HAFTED:
-		case TV_POLEARM:
-		case TV_DIGGING:
-		case TV_BOW:
-		case TV_BOLT:
-		case TV_ARROW:
-		case TV_SHOT:
-		{
-			return (TRUE);
-		}
-	}
-
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_WEAPON) ? TRUE : FALSE);
 }
 
 /*
@@ -1306,18 +1373,7 @@ bool item_tester_hook_weapon(const object_type *o_ptr)
  */
 bool item_tester_hook_melee_weapon(const object_type *o_ptr)
 {
-	switch (o_ptr->tval)
-	{
-		case TV_SWORD:
-		case TV_HAFTED:
-		case TV_POLEARM:
-		case TV_DIGGING:
-		{
-			return (TRUE);
-		}
-	}
-
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_MELEE) ? TRUE : FALSE);
 }
 
 /*
@@ -1325,12 +1381,7 @@ bool item_tester_hook_melee_weapon(const object_type *o_ptr)
  */
 bool item_tester_hook_nonsword(const object_type *o_ptr)
 {
-	if ((o_ptr->tval == TV_HAFTED) || (o_ptr->tval == TV_POLEARM))
-	{
-		return (TRUE);
-	}
-
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_NONSWORD) ? TRUE : FALSE);
 }
 
 
@@ -1340,17 +1391,7 @@ bool item_tester_hook_nonsword(const object_type *o_ptr)
  */
 bool item_tester_hook_ammo(const object_type *o_ptr)
 {
-	switch (o_ptr->tval)
-	{
-		case TV_SHOT:
-		case TV_ARROW:
-		case TV_BOLT:
-		{
-			return (TRUE);
-		}
-	}
-
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_AMMO) ? TRUE : FALSE);
 }
 
 /*
@@ -1358,18 +1399,7 @@ bool item_tester_hook_ammo(const object_type *o_ptr)
  */
 bool item_tester_hook_fletcher(const object_type *o_ptr)
 {
-	switch (o_ptr->tval)
-	{
-		case TV_SHOT:
-		case TV_ARROW:
-		case TV_BOLT:
-		case TV_BOW:
-		{
-			return (TRUE);
-		}
-	}
-
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_FLETCHER) ? TRUE : FALSE);
 }
 
 
@@ -1378,23 +1408,7 @@ bool item_tester_hook_fletcher(const object_type *o_ptr)
  */
 bool item_tester_hook_armour(const object_type *o_ptr)
 {
-	switch (o_ptr->tval)
-	{
-		case TV_DRAG_ARMOR:
-		case TV_HARD_ARMOR:
-		case TV_SOFT_ARMOR:
-		case TV_SHIELD:
-		case TV_CLOAK:
-		case TV_CROWN:
-		case TV_HELM:
-		case TV_BOOTS:
-		case TV_GLOVES:
-		{
-			return (TRUE);
-		}
-	}
-
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_ARMOUR) ? TRUE : FALSE);
 }
 
 /*
@@ -1414,18 +1428,7 @@ bool item_tester_hook_armour_no_acid(const object_type *o_ptr)
  */
 bool item_tester_hook_soft_armour(const object_type *o_ptr)
 {
-	switch (o_ptr->tval)
-	{
-		case TV_SOFT_ARMOR:
-		case TV_CLOAK:
-		case TV_BOOTS:
-		case TV_GLOVES:
-		{
-			return (TRUE);
-		}
-	}
-
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_SOFT_ARMOUR) ? TRUE : FALSE);
 }
 
 /*
@@ -1433,19 +1436,7 @@ bool item_tester_hook_soft_armour(const object_type *o_ptr)
  */
 bool item_tester_hook_hard_armour(const object_type *o_ptr)
 {
-	switch (o_ptr->tval)
-	{
-		case TV_DRAG_ARMOR:
-		case TV_HARD_ARMOR:
-		case TV_SHIELD:
-		case TV_CROWN:
-		case TV_HELM:
-		{
-			return (TRUE);
-		}
-	}
-
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_HARD_ARMOUR) ? TRUE : FALSE);
 }
 
 
@@ -1454,16 +1445,7 @@ bool item_tester_hook_hard_armour(const object_type *o_ptr)
  */
 bool item_tester_hook_helm(const object_type *o_ptr)
 {
-	switch (o_ptr->tval)
-	{
-		case TV_CROWN:
-		case TV_HELM:
-		{
-			return (TRUE);
-		}
-	}
-
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_HELM) ? TRUE : FALSE);
 }
 
 /*
@@ -1471,16 +1453,7 @@ bool item_tester_hook_helm(const object_type *o_ptr)
  */
 bool item_tester_hook_pure_hard_armour(const object_type *o_ptr)
 {
-	switch (o_ptr->tval)
-	{
-		case TV_DRAG_ARMOR:
-		case TV_HARD_ARMOR:
-		{
-			return (TRUE);
-		}
-	}
-
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_PURE_HARD) ? TRUE : FALSE);
 }
 
 
@@ -1490,27 +1463,7 @@ bool item_tester_hook_pure_hard_armour(const object_type *o_ptr)
  */
 bool item_tester_hook_weapon_armour(const object_type *o_ptr)
 {
-	switch (o_ptr->tval)
-	{
-		case TV_SWORD:
-		case TV_HAFTED:
-		case TV_POLEARM:
-		case TV_BOW:
-		case TV_DRAG_ARMOR:
-		case TV_HARD_ARMOR:
-		case TV_SOFT_ARMOR:
-		case TV_SHIELD:
-		case TV_CLOAK:
-		case TV_CROWN:
-		case TV_HELM:
-		case TV_BOOTS:
-		case TV_GLOVES:
-		{
-			return (TRUE);
-		}
-	}
-
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_WEAPON_ARMOUR) ? TRUE : FALSE);
 }
 
 
@@ -1532,17 +1485,7 @@ bool item_tester_hook_wear(const object_type *o_ptr)
  */
 bool item_tester_hook_recharge(const object_type *o_ptr)
 {
-	/* Staffs */
-	if (o_ptr->tval == TV_STAFF) return (TRUE);
-
-	/* Wands */
-	if (o_ptr->tval == TV_WAND) return (TRUE);
-
-	/* Rods */
-	if (o_ptr->tval == TV_ROD) return (TRUE);
-
-	/* Nope */
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_RECHARGE) ? TRUE : FALSE);
 }
 
 /*
@@ -1550,14 +1493,7 @@ bool item_tester_hook_recharge(const object_type *o_ptr)
  */
 bool item_tester_hook_jewel(const object_type *o_ptr)
 {
-	/* Rings */
-	if (o_ptr->tval == TV_RING) return (TRUE);
-
-	/* Amulets */
-	if (o_ptr->tval == TV_AMULET) return (TRUE);
-
-	/* Nope */
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_JEWEL) ? TRUE : FALSE);
 }
 
 bool item_tester_hook_is_blessed(const object_type *o_ptr)
@@ -1612,22 +1548,7 @@ bool item_tester_hook_is_great(const object_type *o_ptr)
 
 bool item_tester_hook_is_book(const object_type *o_ptr)
 {
-	switch (o_ptr->tval)
-	{
-		case TV_SORCERY_BOOK:
-		case TV_NATURE_BOOK:
-		case TV_CHAOS_BOOK:
-		case TV_DEATH_BOOK:
-		case TV_TRUMP_BOOK:
-		case TV_ARCANE_BOOK:
-		case TV_LIFE_BOOK:
-
-			/* It is a book */
-			return (TRUE);
-	}
-
-	/* It isn't a book */
-	return (FALSE);
+	return ((tval_groups(o_ptr->tval) & TVG_BOOK) ? TRUE : FALSE);
 }
 
 
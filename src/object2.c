@@ -86,6 +86,59 @@ static void excise_object_idx(s16b *o_idx_ptr, object_type *o_ptr)
 }
 
 
+/*
+ * The dead entries in the object list.
+ *
+ * This is a stack of the indexes of wiped objects, so that o_pop() does
+ * not have to search the list for a hole.  Stale entries (ones that are
+ * past o_max, or have been reused) are skipped when they are popped, and
+ * the whole stack is rebuilt whenever the list is compacted or loaded.
+ * o_pop() also rebuilds it before giving up.
+ */
+static s16b *o_free = NULL;
+static s16b o_free_num = 0;
+
+
+/*
+ * Put a (wiped) object on the free stack
+ */
+static void o_push(object_type *o_ptr)
+{
+	int o_idx = GET_ARRAY_INDEX(o_list, o_ptr);
+
+	/* Paranoia - only objects in the list */
+	if ((o_idx < 1) || (o_idx >= o_max)) return;
+
+	/* Make the stack */
+	if (!o_free) C_MAKE(o_free, z_info->o_max, s16b);
+
+	/* Paranoia - a full stack only loses the hole until the next rebuild */
+	if (o_free_num >= z_info->o_max) return;
+
+	o_free[o_free_num++] = o_idx;
+}
+
+
+/*
+ * Rebuild the free stack from the object list
+ */
+void o_free_rebuild(void)
+{
+	int i;
+
+	/* Make the stack */
+	if (!o_free) C_MAKE(o_free, z_info->o_max, s16b);
+
+	o_free_num = 0;
+
+	/* Push the highest holes first, so the lowest are used first */
+	for (i = o_max - 1; i >= 1; i--)
+	{
+		if (!o_list[i].k_idx) o_free[o_free_num++] = i;
+	}
+}
+
+
 /*
  * Delete a dungeon object
  *
@@ -99,6 +152,9 @@ void delete_held_object(s16b *o_idx_ptr, object_type *o_ptr)
 	/* Wipe the object */
 	object_wipe(o_ptr);
 
+	/* Recycle the object */
+	o_push(o_ptr);
+
 	/* Count objects */
 	o_cnt--;
 }
@@ -127,6 +183,9 @@ void delete_dungeon_object(object_type *o_ptr)
 	/* Wipe the object */
 	object_wipe(o_ptr);
 
+	/* Recycle the object */
+	o_push(o_ptr);
+
 	/* Count objects */
 	o_cnt--;
 }
@@ -192,6 +251,9 @@ void delete_object_list(s16b *o_idx_ptr)
 		/* Wipe the object */
 		object_wipe(o_ptr);
 
+		/* Recycle the object */
+		o_push(o_ptr);
+
 		/* Count objects */
 		if (o_cnt) o_cnt--;
 	}
@@ -239,6 +301,9 @@ void drop_object_list(s16b *o_idx_ptr, int x, int y)
  *
  * After "compacting" (if needed), we "reorder" the objects into a more
  * compact order, and we reset the allocation info, and the "live" array.
+ *
+ * o_pop() does not need this to find room, so it is only called when
+ * the list is nearly full, or has become mostly holes.
  */
 void compact_objects(int size)
 {
@@ -246,6 +311,8 @@ void compact_objects(int size)
 
 	int cur_lev, cur_dis, chance;
 
+	bool changed = (size > 0);
+
 	object_type *o_ptr;
 
 	monster_type *m_ptr;
@@ -366,7 +433,22 @@ void compact_objects(int size)
 
 		/* Compress "o_max" */
 		o_max--;
+
+		/* Something changed */
+		changed = TRUE;
 	}
+
+	/*
+	 * Objects are not moved, so the holes below the last object stay
+	 * where they are.  Only do the work if the list actually changed.
+	 */
+	if (!changed) return;
+
+	/* Rebuild the free stack */
+	o_free_rebuild();
+
+	/* Count compactions */
+	o_compacted++;
 }
 
 
@@ -439,6 +521,9 @@ void wipe_o_list(void)
 			/* Hack - just kill it */
 			object_wipe(o_ptr);
 
+			/* Recycle the object */
+			o_push(o_ptr);
+
 			/* Count objects */
 			o_cnt--;
 			
@@ -494,89 +579,53 @@ void wipe_objects(int rg_idx)
 }
 
 
-/* Current object counter */
-static s16b o_cur = 1;
-
 /*
  * Acquires and returns the index of a "free" object.
  *
  * This routine should almost never fail, but in case it does,
  * we must be sure to handle "failure" of this routine.
  *
- *
- * We have a choice... scan from o_cur onwards, or use o_max.
- *
- * Using o_max is fast, but it leads to fragmentation.
- * Using o_cur is slower (and might not even give a better
- * result than using o_max), but it leads to a more compact
- * object distribution.
+ * Dead objects are reused (lowest first) before the list grows.
  */
 static s16b o_pop(void)
 {
-	bool wrapped = FALSE;
-
-	/* Wrap counter */
-	if (o_cur >= o_max) o_cur = 1;
-
-	/*
-	 * If the number remaining is less than one third of the
-	 * total number of allocated objects, then add a new object
-	 * to the end of the list.
-	 *
-	 * We add 1 to o_cnt because object 0 is unusable.
-	 *
-	 * Feel free to tune this parameter.
-	 */
-	if ((o_max - (o_cnt + 1)) * 3 < o_max)
-	{
-		/* Initial allocation */
-		if (o_max < z_info->o_max)
-		{
-			/* Expand object array */
-			o_max++;
-
-			/* Count objects */
-			o_cnt++;
-
-			/* Use this object */
-			return (o_max - 1);
-		}
-	}
+	s16b o_idx;
 
 	/* Recycle dead objects */
-	while (TRUE)
+	while (o_free_num)
 	{
-		object_type *o_ptr;
+		o_idx = o_free[--o_free_num];
 
-		/* Acquire object */
-		o_ptr = &o_list[o_cur];
+		/* Skip stale entries */
+		if ((o_idx >= o_max) || o_list[o_idx].k_idx) continue;
 
-		/* Skip live objects */
-		if (o_ptr->k_idx)
-		{
-			/* Increment counter */
-			o_cur++;
+		/* Count objects */
+		o_cnt++;
 
-			/* Wrap counter */
-			if (o_cur >= o_max)
-			{
-				/* Infinite loop protection */
-				if (wrapped) break;
+		/* Use this object */
+		return (o_idx);
+	}
 
-				o_cur = 1;
-				wrapped = TRUE;
-			}
-			continue;
-		}
+	/* Initial allocation */
+	if (o_max < z_info->o_max)
+	{
+		/* Expand object array */
+		o_max++;
 
 		/* Count objects */
 		o_cnt++;
 
 		/* Use this object */
-		return (o_cur);
+		return (o_max - 1);
 	}
 
 
+	/* Look for holes the free stack has lost track of */
+	o_free_rebuild();
+
+	/* Found one */
+	if (o_free_num) return (o_pop());
+
 	/* Warn the player (except during dungeon creation) */
 	if (character_dungeon) msgf("Too many objects!");
 
@@ -672,10 +721,116 @@ void swap_objects(object_type *o1_ptr, object_type *o2_ptr)
 	object_copy(o1_ptr, &temp);
 }
 
+/*
+ * Find the first entry of an allocation table deeper than "level"
+ *
+ * The tables are sorted by depth, so a binary search will do.
+ */
+int alloc_level_index(const alloc_entry *table, int size, int level)
+{
+	int lo = 0, hi = size;
+
+	while (lo < hi)
+	{
+		int mid = (lo + hi) / 2;
+
+		if (table[mid].level > level)
+		{
+			hi = mid;
+		}
+		else
+		{
+			lo = mid + 1;
+		}
+	}
+
+	return (lo);
+}
+
+
+/*
+ * Find the first entry in [lo, hi) whose running total passes "value"
+ *
+ * This is the entry the old "subtract until negative" loop would have
+ * stopped at.  Entries with no probability are never chosen, as the
+ * running total does not change across them.
+ */
+int alloc_prob_index(const s32b *cum, int lo, int hi, s32b value)
+{
+	while (lo < hi)
+	{
+		int mid = (lo + hi) / 2;
+
+		if (cum[mid + 1] > value)
+		{
+			hi = mid;
+		}
+		else
+		{
+			lo = mid + 1;
+		}
+	}
+
+	return (lo);
+}
+
+
+/*
+ * The number of remembered "object restrictions"
+ */
+#define OBJ_PREP_MAX	16
+
+typedef struct obj_prep_type obj_prep_type;
+
+/*
+ * A remembered "object restriction", and the "prob2" values it gave
+ */
+struct obj_prep_type
+{
+	object_hook_type hook;	/* The restriction */
+	u32b key;	/* State the restriction depends on */
+
+	bool valid;	/* The entry is in use */
+
+	u32b used;	/* Time of last use */
+
+	byte *prob;	/* The "prob2" values */
+	s32b *cum;	/* Their running totals */
+};
+
+static obj_prep_type obj_prep[OBJ_PREP_MAX];
+
+static u32b obj_prep_tick = 0;
+
+/*
+ * The state used by kind_is_match() or kind_is_theme()
+ */
+static u32b match_key = 0;
+
+
+/*
+ * Forget the remembered "object restrictions"
+ *
+ * This must be called when the "object allocation table" is rebuilt.
+ */
+void get_obj_num_prep_forget(void)
+{
+	int i;
+
+	for (i = 0; i < OBJ_PREP_MAX; i++)
+	{
+		FREE(obj_prep[i].prob);
+		FREE(obj_prep[i].cum);
+
+		(void)WIPE(&obj_prep[i], obj_prep_type);
+	}
+}
+
+
 /*
  * Apply a "object restriction function" to the "object allocation table"
  */
-void get_obj_num_prep(object_hook_type object_hook)
+static void get_obj_num_prep_aux(object_hook_type object_hook)
 {
 	int i;
 
@@ -684,6 +839,12 @@ void get_obj_num_prep(object_hook_type object_hook)
 	/* Get the entry */
 	alloc_entry *table = alloc_kind_table;
 
+	/* Get the running totals */
+	s32b *cum = alloc_kind_cum;
+
+	/* Start the running total */
+	cum[0] = 0;
+
 	/* Scan the allocation table */
 	for (i = 0; i < alloc_kind_size; i++)
 	{
@@ -704,17 +865,105 @@ void get_obj_num_prep(object_hook_type object_hook)
 			/* Accept this object */
 			table[i].prob2 = table[i].prob1;
 		}
+
+		/* Keep a running total */
+		cum[i + 1] = cum[i] + table[i].prob2;
 	}
 }
 
 
+/*
+ * Apply a "object restriction function" to the "object allocation table"
+ *
+ * The restrictions used here only depend on the object kind, and on
+ * the state set by init_match_hook() or init_match_theme(), so the
+ * result is remembered.  Asking for the same restriction again just
+ * copies the old "prob2" values and running totals back.
+ */
+void get_obj_num_prep(object_hook_type object_hook)
+{
+	obj_prep_type *op_ptr = NULL;
+
+	u32b key = 0;
+
+	int i;
+
+	/* Restrictions we know the state of */
+	if ((object_hook == kind_is_match) || (object_hook == kind_is_theme))
+	{
+		key = match_key;
+	}
+
+	/* Other restrictions */
+	else if (object_hook)
+	{
+		get_obj_num_prep_aux(object_hook);
+
+		return;
+	}
+
+	/* Look for the restriction */
+	for (i = 0; i < OBJ_PREP_MAX; i++)
+	{
+		obj_prep_type *tmp_ptr = &obj_prep[i];
+
+		if (tmp_ptr->valid && (tmp_ptr->hook == object_hook) &&
+			(tmp_ptr->key == key))
+		{
+			/* Restore the old result */
+			for (i = 0; i < alloc_kind_size; i++)
+			{
+				alloc_kind_table[i].prob2 = tmp_ptr->prob[i];
+			}
+
+			(void)C_COPY(alloc_kind_cum, tmp_ptr->cum, alloc_kind_size + 1,
+						 s32b);
+
+			/* Recently used */
+			tmp_ptr->used = ++obj_prep_tick;
+
+			return;
+		}
+
+		/* Remember an empty or the least recently used entry */
+		if (!op_ptr || (op_ptr->valid &&
+			(!tmp_ptr->valid || (tmp_ptr->used < op_ptr->used))))
+		{
+			op_ptr = tmp_ptr;
+		}
+	}
+
+	/* Apply the restriction */
+	get_obj_num_prep_aux(object_hook);
+
+	/* Make room for the result */
+	if (!op_ptr->prob)
+	{
+		C_MAKE(op_ptr->prob, alloc_kind_size, byte);
+		C_MAKE(op_ptr->cum, alloc_kind_size + 1, s32b);
+	}
+
+	/* Remember the result */
+	for (i = 0; i < alloc_kind_size; i++)
+	{
+		op_ptr->prob[i] = alloc_kind_table[i].prob2;
+	}
+
+	(void)C_COPY(op_ptr->cum, alloc_kind_cum, alloc_kind_size + 1, s32b);
+
+	op_ptr->hook = object_hook;
+	op_ptr->key = key;
+	op_ptr->valid = TRUE;
+	op_ptr->used = ++obj_prep_tick;
+}
+
+
 /*
  * Choose an object kind that seems "appropriate" to the given level
  *
- * This function uses the "prob2" field of the "object allocation table",
- * and various local information, to calculate the "prob3" field of the
- * same table, which is then used to choose an "appropriate" object, in
- * a relatively efficient manner.
+ * This function uses the running totals of the "prob2" field of the
+ * "object allocation table" to find the range of "appropriate" objects,
+ * and then to choose one of them with a binary search.
  *
  * It is more likely to acquire an object of the given level
  * than one of a lower level.  This is done by choosing three objects
@@ -725,9 +974,10 @@ void get_obj_num_prep(object_hook_type object_hook)
  */
 s16b get_obj_num(int level, int min_level)
 {
-	int i;
+	int i, lo, hi;
 	long value1, value2, total;
 	alloc_entry *table = alloc_kind_table;
+	s32b *cum = alloc_kind_cum;
 
 	/* Luck gives occasional out-of-depth items */
 	if ((FLAG(p_ptr, TR_STRANGE_LUCK)) && one_in_(13))
@@ -742,21 +992,14 @@ s16b get_obj_num(int level, int min_level)
 		level = 1 + (level * MAX_DEPTH / randint1(MAX_DEPTH));
 	}
 
-	/* Reset total */
-	total = 0L;
+	/* What John West rejects, makes John West the best. */
+	lo = alloc_level_index(table, alloc_kind_size, min_level - 1);
 
-	/* Process probabilities */
-	for (i = 0; i < alloc_kind_size; i++)
-	{
-		/* Objects are sorted by depth */
-		if (table[i].level > level) break;
-
-		/* What John West rejects, makes John West the best. */
-		if (table[i].level < min_level) continue;
+	/* Objects are sorted by depth */
+	hi = alloc_level_index(table, alloc_kind_size, level);
 
-		/* Total */
-		total += table[i].prob2;
-	}
+	/* Total */
+	total = (hi > lo) ? cum[hi] - cum[lo] : 0L;
 
 	/* No legal objects */
 	if (total <= 0) return (0);
@@ -779,17 +1022,7 @@ s16b get_obj_num(int level, int min_level)
 	}
 
 	/* Find the object */
-	for (i = 0; i < alloc_kind_size; i++)
-	{
-		/* What John West rejects, makes John West the best. */
-		if (table[i].level < min_level) continue;
-
-		/* Decrement */
-		value1 -= table[i].prob2;
-
-		/* A match? */
-		if (value1 < 0L) break;
-	}
+	i = alloc_prob_index(cum, lo, hi, cum[lo] + value1);
 
 	/* Result */
 	return (table[i].index);
@@ -3703,6 +3936,9 @@ void init_match_hook(byte tval, byte sval)
 	/* Save the tval/ sval pair to match */
 	match_tv = tval;
 	match_sv = sval;
+
+	/* Describe the state for get_obj_num_prep() */
+	match_key = (u32b)tval | ((u32b)sval << 8);
 }
 
 
@@ -3733,6 +3969,10 @@ void init_match_theme(obj_theme theme)
 {
 	/* Save the theme */
 	match_theme = theme;
+
+	/* Describe the state for get_obj_num_prep() */
+	match_key = (u32b)theme.treasure | ((u32b)theme.combat << 8) |
+		((u32b)theme.magic << 16) | ((u32b)theme.tools << 24);
 }
 
 /*
@@ -622,6 +622,7 @@ void activate_quests(int level)
 				
 				/* Hack - toggle QUESTOR flag */
 				SET_FLAG(&r_info[q_ptr->data.dun.r_idx], RF_QUESTOR);
+				get_mon_num_forget();
 				
 				/* Activate the quest */
 				q_ptr->flags |= QUEST_FLAG_ACTIVE;
@@ -636,6 +637,7 @@ void activate_quests(int level)
 
 				/* Hack - toggle QUESTOR flag */
 				SET_FLAG(r_ptr, RF_QUESTOR);
+				get_mon_num_forget();
 
 				/* Is the player inside the right sort of dungeon? */
 				if (level &&
@@ -2555,7 +2557,7 @@ void draw_quest(place_type *pl_ptr)
 	Rand_value = pl_ptr->seed;
 
 	/* Apply the monster restriction */
-	get_mon_num_prep(camp_types[q_ptr->data.wld.data].hook_func);
+	get_mon_num_prep_key(camp_types[q_ptr->data.wld.data].hook_func, 0);
 
 	/* Set theme for weapons / armour */
 	theme.treasure = 0;
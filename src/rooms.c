@@ -1270,6 +1270,25 @@ static void vault_prep_elemental(void)
     }
 }
 
+/*
+ * Describe the state used by a pit or nest restriction
+ */
+static u32b vault_aux_key(bool (*hook_func) (int r_idx))
+{
+	if (hook_func == vault_aux_clone) return (vault_aux_race);
+	if (hook_func == vault_aux_symbol) return ((byte)vault_aux_char);
+	if (hook_func == vault_aux_dragon) return (vault_aux_dragon_mask4);
+
+	if (hook_func == vault_aux_elemental)
+	{
+		return (vault_aux_elemental_mask4 |
+				((u32b)vault_aux_elemental_attack << 16));
+	}
+
+	/* The others only look at the race */
+	return (0);
+}
+
 typedef struct vault_aux_type vault_aux_type;
 
 
@@ -1530,7 +1549,7 @@ static void build_type5(int bx0, int by0)
 	generate_door(in_x1, in_y1, in_x2, in_y2, TRUE);
 
 	/* Prepare allocation table */
-	get_mon_num_prep(n_ptr->hook_func);
+	get_mon_num_prep_key(n_ptr->hook_func, vault_aux_key(n_ptr->hook_func));
 
 	/* Pick some monster types */
 	for (i = 0; i < 64; i++)
@@ -1738,7 +1757,7 @@ static void build_type6(int bx0, int by0)
 	generate_door(in_x1, in_y1, in_x2, in_y2, TRUE);
 
 	/* Prepare allocation table */
-	get_mon_num_prep(n_ptr->hook_func);
+	get_mon_num_prep_key(n_ptr->hook_func, vault_aux_key(n_ptr->hook_func));
 
 	/* Pick some monster types */
 	for (i = 0; i < 16; i++)
@@ -647,7 +647,7 @@ static void wr_field(const field_type *f_ptr)
 	wr_u16b(f_ptr->info);
 
 	/* Counter */
-	wr_s16b(f_ptr->counter);
+	wr_s16b(field_counter(f_ptr));
 
 	/* Data */
 	for (i = 0; i < 8; i++)
@@ -804,8 +804,11 @@ static void wr_options(void)
 
 	/*** Oops ***/
 
+	/* Write "window_delay" (in the old option space) */
+	wr_byte(window_delay);
+
 	/* Oops */
-	for (i = 0; i < 4; i++) wr_u32b(0L);
+	for (i = 0; i < 15; i++) wr_byte(0);
 
 
 	/*** Special Options ***/
@@ -1069,92 +1072,63 @@ static void wr_extra(void)
 }
 
 /*
- * Save the dungeon or wilderness
+ * Write a block of data as a packed "section"
+ *
+ * Each section starts with its unpacked and packed sizes, so that
+ * the data can be checked (or skipped) without unpacking it.
  */
-
-static void save_map(int xmin, int ymin, int xmax, int ymax)
+static void wr_section(const byte *data, u32b len)
 {
-	int y, x;
-
-	byte tmp8u;
-
-	byte count;
-	byte prev_char;
-
-	cave_type *c_ptr;
-	pcave_type *pc_ptr;
+	byte *packed;
+	u32b size, i;
 
-	/*** Simple "Run-Length-Encoding" of cave ***/
+	/* Pack the data */
+	C_MAKE(packed, lz_bound(len), byte);
+	size = lz_pack(data, len, packed);
 
-	/* Note that this will induce two wasted bytes */
-	count = 0;
-	prev_char = 0;
+	/* Section header */
+	wr_u32b(len);
+	wr_u32b(size);
 
-	/* Dump the cave */
-	for (y = ymin; y < ymax; y++)
-	{
-		for (x = xmin; x < xmax; x++)
-		{
-			/* Get the cave */
-			c_ptr = area(x, y);
-
-			/* Extract a byte */
-			tmp8u = c_ptr->info;
+	/* Dump the data */
+	for (i = 0; i < size; i++) wr_byte(packed[i]);
 
-			/* If the run is broken, or too full, flush it  */
-			if ((tmp8u != prev_char) || (count == MAX_UCHAR))
-			{
-				wr_byte((byte)count);
-				wr_byte((byte)prev_char);
-				prev_char = tmp8u;
-				count = 1;
-			}
+	/* Done */
+	FREE(packed);
+}
 
-			/* Continue the run */
-			else
-			{
-				count++;
-			}
-		}
-	}
 
-	/* Flush the data (if any) */
-	if (count)
-	{
-		wr_byte((byte)count);
-		wr_byte((byte)prev_char);
-	}
+/*
+ * Write a block of data with a simple "Run-Length-Encoding"
+ *
+ * This is the format used before the sections were packed.
+ */
+static void wr_rle(const byte *data, u32b len)
+{
+	u32b i;
 
+	byte count;
+	byte prev_char;
 
 	/* Note that this will induce two wasted bytes */
 	count = 0;
 	prev_char = 0;
 
-	/* Dump the cave */
-	for (y = ymin; y < ymax; y++)
+	for (i = 0; i < len; i++)
 	{
-		for (x = xmin; x < xmax; x++)
+		/* If the run is broken, or too full, flush it */
+		if ((data[i] != prev_char) || (count == MAX_UCHAR))
 		{
-			/* Get the cave */
-			pc_ptr = parea(x, y);
-
-			/* Extract a byte */
-			tmp8u = pc_ptr->player;
-
-			/* If the run is broken, or too full, flush it  */
-			if ((tmp8u != prev_char) || (count == MAX_UCHAR))
-			{
-				wr_byte((byte)count);
-				wr_byte((byte)prev_char);
-				prev_char = tmp8u;
-				count = 1;
-			}
+			wr_byte((byte)count);
+			wr_byte((byte)prev_char);
+			prev_char = data[i];
+			count = 1;
+		}
 
-			/* Continue the run */
-			else
-			{
-				count++;
-			}
+		/* Continue the run */
+		else
+		{
+			count++;
 		}
 	}
 
@@ -1164,122 +1138,133 @@ static void save_map(int xmin, int ymin, int xmax, int ymax)
 		wr_byte((byte)count);
 		wr_byte((byte)prev_char);
 	}
+}
 
 
-	/* Note that this will induce two wasted bytes */
-	count = 0;
-	prev_char = 0;
-
-	/* Dump the cave */
-	for (y = ymin; y < ymax; y++)
-	{
-		for (x = xmin; x < xmax; x++)
-		{
-			/* Get the cave */
-			pc_ptr = parea(x, y);
-
-			/* Extract a byte */
-			tmp8u = pc_ptr->feat;
-
-			/* If the run is broken, or too full, flush it  */
-			if ((tmp8u != prev_char) || (count == MAX_UCHAR))
-			{
-				wr_byte((byte)count);
-				wr_byte((byte)prev_char);
-				prev_char = tmp8u;
-				count = 1;
-			}
-
-			/* Continue the run */
-			else
-			{
-				count++;
-			}
-		}
-	}
+/*
+ * Save the dungeon or wilderness
+ *
+ * The map is dumped as four "planes" (cave info, player info,
+ * remembered feature and real feature), either as one packed section,
+ * or run-length-encoded one after another in the older format.
+ */
+static void save_map(int xmin, int ymin, int xmax, int ymax)
+{
+	int y, x;
 
-	/* Flush the data (if any) */
-	if (count)
-	{
-		wr_byte((byte)count);
-		wr_byte((byte)prev_char);
-	}
+	u32b size = (u32b)(xmax - xmin) * (u32b)(ymax - ymin);
 
+	byte *plane, *info, *player, *pfeat, *feat;
 
+	cave_type *c_ptr;
+	pcave_type *pc_ptr;
 
-	/*** Simple "Run-Length-Encoding" of cave ***/
+	/* Make the planes */
+	C_MAKE(plane, size * 4, byte);
 
-	/* Note that this will induce two wasted bytes */
-	count = 0;
-	prev_char = 0;
+	info = plane;
+	player = info + size;
+	pfeat = player + size;
+	feat = pfeat + size;
 
-	/* Dump the cave */
+	/* Fill them in */
 	for (y = ymin; y < ymax; y++)
 	{
 		for (x = xmin; x < xmax; x++)
 		{
 			/* Get the cave */
 			c_ptr = area(x, y);
+			pc_ptr = parea(x, y);
 
-			/* Extract a byte */
-			tmp8u = c_ptr->feat;
-
-			/* If the run is broken, or too full, flush it */
-			if ((tmp8u != prev_char) || (count == MAX_UCHAR))
-			{
-				wr_byte((byte)count);
-				wr_byte((byte)prev_char);
-				prev_char = tmp8u;
-				count = 1;
-			}
-
-			/* Continue the run */
-			else
-			{
-				count++;
-			}
+			*info++ = c_ptr->info;
+			*player++ = pc_ptr->player;
+			*pfeat++ = pc_ptr->feat;
+			*feat++ = c_ptr->feat;
 		}
 	}
 
-	/* Flush the data (if any) */
-	if (count)
+	/* Dump them */
+	if (pack_savefile)
 	{
-		wr_byte((byte)count);
-		wr_byte((byte)prev_char);
+		wr_section(plane, size * 4);
 	}
+	else
+	{
+		wr_rle(plane, size);
+		wr_rle(plane + size, size);
+		wr_rle(plane + size * 2, size);
+		wr_rle(plane + size * 3, size);
+	}
+
+	FREE(plane);
 }
 
 /*
  * Save wilderness data
+ *
+ * Each field of the wilderness blocks gets its own "plane" in the
+ * packed section, since similar bytes compress much better together.
  */
 static void save_wild_data(void)
 {
 	int i, j;
 
+	u32b size = (u32b)max_wild * (u32b)max_wild;
+
+	byte *plane, *ptr;
+
+	wild_done_type *w_ptr;
+
 	/* Save wilderness seed */
 	wr_u32b(wild_seed);
 
+	/* Make the planes */
+	C_MAKE(plane, size * WILD_SECTION_PLANES, byte);
+
 	/* Save wilderness map */
-	for (i = 0; i < max_wild; i++)
+	for (i = 0, ptr = plane; i < max_wild; i++)
 	{
-		for (j = 0; j < max_wild; j++)
+		for (j = 0; j < max_wild; j++, ptr++)
 		{
+			w_ptr = &wild[j][i].done;
+
 			/* Terrain */
-			wr_u16b(wild[j][i].done.wild);
+			ptr[0] = (byte)(w_ptr->wild & 0xFF);
+			ptr[size] = (byte)(w_ptr->wild >> 8);
 
 			/* Places */
-			wr_byte(wild[j][i].done.place);
+			ptr[size * 2] = w_ptr->place;
 
 			/* Info flag */
-			wr_byte(wild[j][i].done.info);
+			ptr[size * 3] = w_ptr->info;
 
 			/* Monster Gen type */
-			wr_byte(wild[j][i].done.mon_gen);
+			ptr[size * 4] = w_ptr->mon_gen;
 
 			/* Monster Probability */
-			wr_byte(wild[j][i].done.mon_prob);
+			ptr[size * 5] = w_ptr->mon_prob;
 		}
 	}
+
+	/* Dump them */
+	if (pack_savefile)
+	{
+		wr_section(plane, size * WILD_SECTION_PLANES);
+	}
+	else
+	{
+		/* The older format has the fields of each block together */
+		for (ptr = plane; ptr < plane + size; ptr++)
+		{
+			wr_u16b((u16b)(ptr[0] | (ptr[size] << 8)));
+			wr_byte(ptr[size * 2]);
+			wr_byte(ptr[size * 3]);
+			wr_byte(ptr[size * 4]);
+			wr_byte(ptr[size * 5]);
+		}
+	}
+
+	FREE(plane);
 }
 
 /*
@@ -1416,8 +1401,8 @@ static bool wr_savefile_new(void)
 	v_stamp = 0L;
 	x_stamp = 0L;
 
-	/* Write the savefile version */
-	wr_u32b(SAVEFILE_VERSION);
+	/* Write the savefile version (the older one has no packed sections) */
+	wr_u32b(pack_savefile ? SAVEFILE_VERSION : SAVEFILE_VERSION_UNPACKED);
 
 	/* Operating system */
 	wr_u32b(sf_xtra);
@@ -1827,6 +1812,21 @@ static bool save_player_aux(char *name)
 
 
 
+#ifdef BACKGROUND_AUTOSAVE
+
+/*
+ * The process writing a background autosave (or zero)
+ */
+static pid_t autosave_pid = 0;
+
+/*
+ * Another autosave was asked for while that one was running
+ */
+static bool autosave_again = FALSE;
+
+#endif /* BACKGROUND_AUTOSAVE */
+
+
 /*
  * Attempt to save the player in a savefile
  */
@@ -1836,6 +1836,9 @@ bool save_player(void)
 
 	char safe[1024];
 
+	/* Never race a background autosave for the ".new" file */
+	(void)save_player_background_check(TRUE);
+
 	/* New savefile */
 	strnfmt(safe, 1024, "%s.new", savefile);
 
@@ -1897,6 +1900,139 @@ bool save_player(void)
 }
 
 
+/*
+ * Attempt to save the player without stopping the game.
+ *
+ * We fork(), and let the child write the savefile using the normal
+ * save_player() code.  The child sees a copy-on-write snapshot of the
+ * game as it was at the moment of the fork, so the savefile is always
+ * consistent, no matter what the parent does in the meantime.
+ *
+ * We return "TRUE" if the save is now happening in the background, and
+ * "FALSE" if the caller should save the game itself.
+ *
+ * The result is reported later by save_player_background_check().
+ */
+bool save_player_background(void)
+{
+#ifdef BACKGROUND_AUTOSAVE
+
+	pid_t pid;
+
+	/* See if the last one has finished */
+	(void)save_player_background_check(FALSE);
+
+	/* Still busy - save again once it is done */
+	if (autosave_pid)
+	{
+		autosave_again = TRUE;
+
+		return (TRUE);
+	}
+
+	/* Flush pending output, so the child does not repeat it */
+	(void)fflush(stdout);
+	(void)fflush(stderr);
+
+	/* Split in two */
+	pid = fork();
+
+	/* Failure - do it the slow way */
+	if (pid < 0) return (FALSE);
+
+	/* The child */
+	if (!pid)
+	{
+		/* Leave the terminal alone (ignore keyboard signals) */
+		(void)setsid();
+
+		/* Write the savefile, and report the result (no cleanup) */
+		_exit(save_player() ? 0 : 1);
+	}
+
+	/* Remember the child */
+	autosave_pid = pid;
+
+	/* Success */
+	return (TRUE);
+
+#else /* BACKGROUND_AUTOSAVE */
+
+	/* Not supported */
+	return (FALSE);
+
+#endif /* BACKGROUND_AUTOSAVE */
+}
+
+
+/*
+ * Notice when a background autosave has finished, and report it.
+ *
+ * If "wait" is set, then block until any pending autosave is done.
+ *
+ * We return "TRUE" if another autosave was asked for while the last
+ * one was running, and the caller should autosave again now.
+ */
+bool save_player_background_check(bool wait)
+{
+#ifdef BACKGROUND_AUTOSAVE
+
+	int status = 0;
+	pid_t pid;
+
+	/* Nothing is happening */
+	if (!autosave_pid) return (FALSE);
+
+	/* Poll (or wait for) the child */
+	pid = waitpid(autosave_pid, &status, wait ? 0 : WNOHANG);
+
+	/* Still running */
+	if (!pid) return (FALSE);
+
+	/* The child is gone */
+	autosave_pid = 0;
+
+	/* Success */
+	if ((pid > 0) && WIFEXITED(status) && !WEXITSTATUS(status))
+	{
+		/* The child counted the save in its copy */
+		sf_saves++;
+
+		/* Hack -- Pretend the character was loaded */
+		character_loaded = TRUE;
+
+		/* Don't bother the player at exit */
+		if (!wait) msgf("Autosave complete.");
+	}
+
+	/* Failure */
+	else
+	{
+		msgf("Autosave failed!");
+	}
+
+	/* Was another autosave asked for? */
+	if (autosave_again)
+	{
+		autosave_again = FALSE;
+
+		/* A full save is about to happen anyway */
+		if (!wait) return (TRUE);
+	}
+
+	return (FALSE);
+
+#else /* BACKGROUND_AUTOSAVE */
+
+	/* Hack - ignore wait */
+	(void)wait;
+
+	return (FALSE);
+
+#endif /* BACKGROUND_AUTOSAVE */
+}
+
+
 
 /*
  * Attempt to Load a "savefile"
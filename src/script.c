@@ -38,14 +38,15 @@ void apply_object_trigger(int trigger_id, object_type *o_ptr, cptr format, ...)
 	void *q_ptr = NULL;
 	
 	bool success = FALSE;
-#if 0	
+
+	/* Most objects have no script at all */
 	if (o_ptr->trigger[trigger_id])
 		script = quark_str(o_ptr->trigger[trigger_id]);
 	else if (k_ptr->trigger[trigger_id])
 		script = k_text + k_ptr->trigger[trigger_id];
 	else
 		return;
-	
+#if 0
 	/* Save parameter so recursion works. */
 	lua_getglobal (L, "object");
 	if (tolua_istype(L, -1, tolua_tag(L, "object_type"), 0))
@@ -69,6 +70,9 @@ void apply_object_trigger(int trigger_id, object_type *o_ptr, cptr format, ...)
 	/* Restore global so recursion works*/
 	tolua_pushusertype(L, q_ptr, tolua_tag(L,"object_type"));
 	lua_setglobal(L, "object");
+#else
+	/* No scripting - the script cannot be run */
+	(void)script;
 #endif
 	/* Paranoia */
 	if (!success)
@@ -109,6 +113,122 @@ void deleteme(void)
 	field_delete = TRUE;
 }
 
+/*
+ * The field actions, resolved once when the field types are loaded.
+ *
+ * There are FIELD_ACTION_MAX entries for each field type.
+ */
+typedef struct field_trigger_type field_trigger_type;
+
+struct field_trigger_type
+{
+	cptr script;	/* Script to run */
+	field_trigger_func func;	/* Native replacement for the script */
+};
+
+static field_trigger_type *field_trigger_list = NULL;
+
+
+/*
+ * Field actions that are done in C rather than by their script.
+ *
+ * These should match what the scripts in t_info.txt do.
+ */
+typedef struct field_native_type field_native_type;
+
+struct field_native_type
+{
+	cptr name;	/* Name of the field type */
+	int action;	/* Action to replace */
+	field_trigger_func func;	/* Function to use */
+};
+
+static const field_native_type field_native[] =
+{
+	{NULL, 0, NULL}
+};
+
+
+/*
+ * Use a native function instead of the script for a field action.
+ *
+ * Returns FALSE if there is no such field type.
+ */
+bool field_trigger_register(cptr name, int action, field_trigger_func func)
+{
+	int i;
+
+	bool found = FALSE;
+
+	for (i = 1; i < z_info->t_max; i++)
+	{
+		field_thaum *t_ptr = &t_info[i];
+
+		if (!t_ptr->name || !streq(t_ptr->name, name)) continue;
+
+		field_trigger_list[i * FIELD_ACTION_MAX + action].func = func;
+
+		found = TRUE;
+	}
+
+	return (found);
+}
+
+
+/*
+ * Resolve the field actions.
+ *
+ * This must be called after t_info is loaded, so the scripts are
+ * looked up once, rather than every time a field does something.
+ */
+errr init_field_triggers(void)
+{
+	int i, j;
+
+	const field_native_type *fn_ptr;
+
+	C_MAKE(field_trigger_list, z_info->t_max * FIELD_ACTION_MAX,
+		   field_trigger_type);
+
+	for (i = 0; i < z_info->t_max; i++)
+	{
+		field_thaum *t_ptr = &t_info[i];
+
+		for (j = 0; j < FIELD_ACTION_MAX; j++)
+		{
+			if (!t_ptr->action[j]) continue;
+
+			field_trigger_list[i * FIELD_ACTION_MAX + j].script =
+				quark_str(t_ptr->action[j]);
+		}
+	}
+
+	/* Add the native actions */
+	for (fn_ptr = field_native; fn_ptr->name; fn_ptr++)
+	{
+		if (!field_trigger_register(fn_ptr->name, fn_ptr->action,
+									fn_ptr->func))
+		{
+			/* Oops */
+			msgf("No field type '%s' for native action.", fn_ptr->name);
+			return (-1);
+		}
+	}
+
+	/* Success */
+	return (0);
+}
+
+
+/*
+ * Free the field actions
+ */
+void free_field_triggers(void)
+{
+	FREE(field_trigger_list);
+}
+
+
 /*
  * Apply an field trigger, a small lua script which does
  * what the old field action functions did.
@@ -158,18 +278,52 @@ bool apply_field_trigger(cptr script, field_type *f_ptr, cptr format, va_list vp
 
 
 /*
- * Apply an field trigger, a small lua script which does
- * what the old field action functions did.
+ * Does the field have anything to do for this action?
+ *
+ * This looks at the resolved actions, so a native function
+ * counts even if the field type has no script for the action.
+ */
+bool field_has_trigger(const field_type *f_ptr, int action)
+{
+	field_trigger_type *ft_ptr =
+		&field_trigger_list[f_ptr->t_idx * FIELD_ACTION_MAX + action];
+
+	return (ft_ptr->func || ft_ptr->script);
+}
+
+
+/*
+ * Do a field action, using the native version if there is one.
+ *
+ * Returns TRUE if the field wants to be deleted.
+ */
+bool field_trigger(field_type *f_ptr, int action, cptr format, va_list vp)
+{
+	field_trigger_type *ft_ptr =
+		&field_trigger_list[f_ptr->t_idx * FIELD_ACTION_MAX + action];
+
+	/* Native version */
+	if (ft_ptr->func) return ((*ft_ptr->func) (f_ptr, vp));
+
+	/* Nothing to do */
+	if (!ft_ptr->script) return (FALSE);
+
+	return (apply_field_trigger(ft_ptr->script, f_ptr, format, vp));
+}
+
+
+/*
+ * Do a field action.
  *
  * This version doesn't modify the field, but uses a copy instead.
  * This allows const versions of field hooks.
  *
  * The field cannot be deleted.
  */
-void const_field_trigger(cptr script, const field_type *f_ptr, cptr format, va_list vp)
+void const_field_trigger(const field_type *f_ptr, int action, cptr format, va_list vp)
 {
 	/* Structure copy to get local working version */
 	field_type temp_field = *f_ptr;
 	
-	(void) apply_field_trigger(script, &temp_field, format, vp);
+	(void) field_trigger(&temp_field, action, format, vp);
 }
@@ -40,11 +40,40 @@ extern void apply_object_trigger(int trigger_id, object_type *o_ptr, cptr format
  */
 extern bool use_object(object_type *o_ptr, bool *ident, int aim);
 #endif
+/*
+ * A native field action.
+ *
+ * It is passed the same arguments as the script would be,
+ * and returns TRUE if the field wants to be deleted.
+ */
+typedef bool (*field_trigger_func)(field_type *f_ptr, va_list vp);
+
+/*
+ * Resolve the field actions once the field types are loaded
+ */
+extern errr init_field_triggers(void);
+
+/*
+ * Free the field actions
+ */
+extern void free_field_triggers(void);
+
+/*
+ * Use a native function instead of the script for a field action
+ */
+extern bool field_trigger_register(cptr name, int action, field_trigger_func func);
+
+/*
+ * Does a field have a script or native function for an action?
+ */
+extern bool field_has_trigger(const field_type *f_ptr, int action);
+
 /*
  * Execute a script attached to a field
  */
 extern bool apply_field_trigger(cptr script, field_type *f_ptr, cptr format, va_list vp);
-extern void const_field_trigger(cptr script, const field_type *f_ptr, cptr format, va_list vp);
+extern bool field_trigger(field_type *f_ptr, int action, cptr format, va_list vp);
+extern void const_field_trigger(const field_type *f_ptr, int action, cptr format, va_list vp);
 #if 0
 /*
  * Debug lua stack depth
@@ -160,6 +160,9 @@ static const field_type *f_ptr = NULL;
 /* Save info flags for store */
 static byte info_flags;
 
+/* Hack - store_maint() sorts the stock itself */
+static bool store_unsorted = FALSE;
+
 
 
 /*
@@ -766,6 +769,9 @@ static object_type *store_carry(object_type *o_ptr)
 	/* No longer marked */
 	o_ptr->info &= ~(OB_SEEN);
 
+	/* The stock will be sorted later */
+	if (store_unsorted) return (o_ptr);
+
 	/* Reorder the items */
 	o_ptr = reorder_objects_aux(o_ptr, reorder_store_comp, st_ptr->stock);
 
@@ -814,6 +820,8 @@ static void store_delete(void)
 
 /*
  * Creates a random item and gives it to a store
+ *
+ * The allocation table must have been prepared by store_maint().
  */
 static void store_create(void)
 {
@@ -822,25 +830,11 @@ static void store_create(void)
 
 	object_type *q_ptr;
 
-	obj_theme theme;
-
 	byte restricted = f_ptr->data[7];
 
 	/* Paranoia -- no room left */
 	if (get_list_length(st_ptr->stock) >= st_ptr->max_stock) return;
 
-	/* Set theme */
-	theme.treasure = f_ptr->data[3];
-	theme.combat = f_ptr->data[4];
-	theme.magic = f_ptr->data[5];
-	theme.tools = f_ptr->data[6];
-
-	/* Select items based on "theme" */
-	init_match_theme(theme);
-
-	/* Prepare allocation table */
-	get_obj_num_prep(kind_is_theme);
-
 	/* Hack -- consider up to fifty items */
 	for (tries = 0; tries < 50; tries++)
     {
@@ -1153,84 +1147,117 @@ static void display_store(void)
 
 
 /*
- * Maintain the inventory at the stores.
+ * Maintain the inventory at the stores "num" times.
+ *
+ * The allocation table is only prepared once, and the stock is only
+ * sorted at the end.  Items are deleted from random slots, so the
+ * order of the stock while it is being maintained does not matter.
  */
-static void store_maint(void)
+static void store_maint(int num)
 {
-	int i = 0, j;
+	int i, j, n;
+
+	obj_theme theme;
 
 	/* Ignore home + locker */
 	if (st_ptr->type == BUILD_STORE_HOME) return;
 
-	/* Choose the number of slots to keep */
-	j = get_list_length(st_ptr->stock);
+	/* Set theme */
+	theme.treasure = f_ptr->data[3];
+	theme.combat = f_ptr->data[4];
+	theme.magic = f_ptr->data[5];
+	theme.tools = f_ptr->data[6];
 
-	/* Sell a few items */
-	j = j - randint1(STORE_TURNOVER);
+	/* Select items based on "theme" */
+	init_match_theme(theme);
 
-	if (st_ptr->max_stock == STORE_INVEN_MAX)
-	{
-		/* Never keep more than "STORE_MAX_KEEP" slots */
-		if (j > STORE_MAX_KEEP1) j = STORE_MAX_KEEP1;
+	/* Prepare allocation table */
+	get_obj_num_prep(kind_is_theme);
 
-		/* Always "keep" at least "STORE_MIN_KEEP" items */
-		if (j < STORE_MIN_KEEP1) j = STORE_MIN_KEEP1;
-	}
-	else
+	/* Sort the stock later */
+	store_unsorted = TRUE;
+
+	for (n = 0; n < num; n++)
 	{
-		/* The store has half the normal inventory space */
+		/* Reset the counter */
+		i = 0;
 
-		/* Never keep more than "STORE_MAX_KEEP" slots */
-		if (j > STORE_MAX_KEEP2) j = STORE_MAX_KEEP2;
+		/* Choose the number of slots to keep */
+		j = get_list_length(st_ptr->stock);
 
-		/* Always "keep" at least "STORE_MIN_KEEP" items */
-		if (j < STORE_MIN_KEEP2) j = STORE_MIN_KEEP2;
-	}
+		/* Sell a few items */
+		j = j - randint1(STORE_TURNOVER);
 
-	/* Hack -- prevent "underflow" (This should never happen anyway.) */
-	if (j < 0) j = 0;
+		if (st_ptr->max_stock == STORE_INVEN_MAX)
+		{
+			/* Never keep more than "STORE_MAX_KEEP" slots */
+			if (j > STORE_MAX_KEEP1) j = STORE_MAX_KEEP1;
 
-	/* Destroy objects until only "j" slots are left */
-	while (get_list_length(st_ptr->stock) > j) store_delete();
+			/* Always "keep" at least "STORE_MIN_KEEP" items */
+			if (j < STORE_MIN_KEEP1) j = STORE_MIN_KEEP1;
+		}
+		else
+		{
+			/* The store has half the normal inventory space */
 
+			/* Never keep more than "STORE_MAX_KEEP" slots */
+			if (j > STORE_MAX_KEEP2) j = STORE_MAX_KEEP2;
 
-	/* Choose the number of slots to fill */
-	j = get_list_length(st_ptr->stock);
+			/* Always "keep" at least "STORE_MIN_KEEP" items */
+			if (j < STORE_MIN_KEEP2) j = STORE_MIN_KEEP2;
+		}
 
-	/* Buy some more items */
-	j = j + randint1(STORE_TURNOVER);
+		/* Hack -- prevent "underflow" (This should never happen anyway.) */
+		if (j < 0) j = 0;
 
-	if (st_ptr->max_stock == STORE_INVEN_MAX)
-	{
-		/* Never keep more than "STORE_MAX_KEEP" slots */
-		if (j > STORE_MAX_KEEP1) j = STORE_MAX_KEEP1;
+		/* Destroy objects until only "j" slots are left */
+		while (get_list_length(st_ptr->stock) > j) store_delete();
 
-		/* Always "keep" at least "STORE_MIN_KEEP" items */
-		if (j < STORE_MIN_KEEP1) j = STORE_MIN_KEEP1;
-	}
-	else
-	{
-		/* The store has half the normal inventory space */
 
-		/* Never keep more than "STORE_MAX_KEEP" slots */
-		if (j > STORE_MAX_KEEP2) j = STORE_MAX_KEEP2;
+		/* Choose the number of slots to fill */
+		j = get_list_length(st_ptr->stock);
 
-		/* Always "keep" at least "STORE_MIN_KEEP" items */
-		if (j < STORE_MIN_KEEP2) j = STORE_MIN_KEEP2;
-	}
+		/* Buy some more items */
+		j = j + randint1(STORE_TURNOVER);
 
-	/* Hack -- prevent "overflow" (This shouldn't do anything) */
-	if (j >= st_ptr->max_stock) j = st_ptr->max_stock - 1;
+		if (st_ptr->max_stock == STORE_INVEN_MAX)
+		{
+			/* Never keep more than "STORE_MAX_KEEP" slots */
+			if (j > STORE_MAX_KEEP1) j = STORE_MAX_KEEP1;
 
-	/* Acquire some new items */
-	while ((get_list_length(st_ptr->stock) < j) && (i < 30))
-	{
-		/* Increment counter so we avoid taking too long */
-		i++;
+			/* Always "keep" at least "STORE_MIN_KEEP" items */
+			if (j < STORE_MIN_KEEP1) j = STORE_MIN_KEEP1;
+		}
+		else
+		{
+			/* The store has half the normal inventory space */
+
+			/* Never keep more than "STORE_MAX_KEEP" slots */
+			if (j > STORE_MAX_KEEP2) j = STORE_MAX_KEEP2;
+
+			/* Always "keep" at least "STORE_MIN_KEEP" items */
+			if (j < STORE_MIN_KEEP2) j = STORE_MIN_KEEP2;
+		}
 
-		/* Try to allocate some items */
-		store_create();
+		/* Hack -- prevent "overflow" (This shouldn't do anything) */
+		if (j >= st_ptr->max_stock) j = st_ptr->max_stock - 1;
+
+		/* Acquire some new items */
+		while ((get_list_length(st_ptr->stock) < j) && (i < 30))
+		{
+			/* Increment counter so we avoid taking too long */
+			i++;
+
+			/* Try to allocate some items */
+			store_create();
+		}
 	}
+
+	/* Done */
+	store_unsorted = FALSE;
+
+	/* Reorder the items */
+	(void)reorder_objects_aux(NULL, reorder_store_comp, st_ptr->stock);
 }
 
 
@@ -1592,11 +1619,7 @@ static void store_purchase(void)
 				}
 
 				/* New inventory */
-				for (i = 0; i < 10; i++)
-				{
-					/* Maintain the store */
-					store_maint();
-				}
+				store_maint(10);
 
 				/* Start over */
 				p_ptr->state.store_top = 0;
@@ -2456,7 +2479,6 @@ void do_cmd_store(const field_type *f1_ptr)
 {
 	int maintain_num;
 	int tmp_chr;
-	int i;
 
 	object_type *o_ptr;
 	
@@ -2514,10 +2536,7 @@ void do_cmd_store(const field_type *f1_ptr)
 	if (maintain_num)
 	{
 		/* Maintain the store */
-		for (i = 0; i < maintain_num; i++)
-		{
-			store_maint();
-		}
+		store_maint(maintain_num);
 
 		/* Save the visit */
 		st_ptr->last_visit = turn;
@@ -6122,7 +6122,7 @@ option_type option_info[OPT_MAX] =
 	{FALSE, 0, NULL,					"Number 51" },
 	{TRUE,  4, "flush_failure",			"Flush input on various failures" },
 	{FALSE, 4, "flush_disturb",			"Flush input whenever disturbed" },
-	{FALSE, 0, NULL,					"Number 54" },
+	{FALSE, 4, "pack_savefile",			"Pack the map in savefiles (newer format)" },
 	{TRUE,  4, "fresh_before",			"Flush output before every command" },
 	{FALSE, 4, "fresh_after",			"Flush output after every command" },
 	{FALSE, 2, "emergency_stop",		"Halt all input after hp warning" },
@@ -474,6 +474,9 @@ struct cave_type
 
 	s16b fld_idx;	/* Field in this grid */
 
+	u16b fld_info;	/* Flags of the fields in this grid (FIELD_INFO_GRID) */
+	u16b fld_type;	/* Types of the fields in this grid (FTYPE_FLAG()) */
+
 	byte cost;	/* Hack -- cost of flowing */
 	byte when;	/* Hack -- when cost was computed */
 };
@@ -549,6 +549,45 @@ void signals_init(void)
 #endif /* HANDLE_SIGNALS */
 
 
+/*
+ * Hack -- only some systems have a real time clock with a fine grain,
+ * the others use the processor time (which is nearly the same thing
+ * while the game is busy).
+ */
+#if defined(SET_UID) && defined(__linux__)
+# define USE_WALL_CLOCK
+#endif /* SET_UID && __linux__ */
+
+
+/*
+ * Get the time, in microseconds.
+ *
+ * This wraps around every 71 minutes or so, so it is only of use to
+ * time shorter things (by the difference of two calls, as a u32b).
+ */
+u32b time_usec(void)
+{
+#ifdef USE_WALL_CLOCK
+
+	struct timeval tv;
+
+	(void)gettimeofday(&tv, NULL);
+
+	return ((u32b)tv.tv_sec * 1000000UL + (u32b)tv.tv_usec);
+
+#else  /* USE_WALL_CLOCK */
+
+	clock_t ticks = clock();
+
+	u32b sec = (u32b)(ticks / CLOCKS_PER_SEC);
+
+	return (sec * 1000000UL +
+			(u32b)((ticks - sec * CLOCKS_PER_SEC) * 1000000.0 / CLOCKS_PER_SEC));
+
+#endif /* USE_WALL_CLOCK */
+}
+
+
 #ifdef SET_UID
 
 # ifndef HAS_USLEEP
@@ -967,6 +1006,9 @@ static errr my_fgets_aux(FILE *fff, char *buf, huge n, bool strip)
 	/* Read a line */
 	if (fgets(tmp, 1024, fff))
 	{
+		/* Count it */
+		file_bytes_read += strlen(tmp);
+
 		/* Convert weirdness */
 		for (s = tmp; *s; s++)
 		{
@@ -1273,6 +1315,9 @@ errr fd_read(int fd, char *buf, huge n)
 	/* Verify the fd */
 	if (fd < 0) return (-1);
 
+	/* Count it */
+	file_bytes_read += n;
+
 #ifndef SET_UID
 
 	/* Read pieces */
@@ -2128,6 +2173,9 @@ char inkey(void)
 		/* Hack -- Flush output once when no key ready */
 		if (!done && (0 != Term_inkey(&kk, FALSE, FALSE)))
 		{
+			/* Catch up on the subwindows */
+			frame_stuff();
+
 			/* Hack -- activate proper term */
 			Term_activate(old);
 
@@ -2411,6 +2459,9 @@ void quark_remove(s16b *i)
 	{
 		string_free(quark__str[*i]);
 		quark__str[*i] = NULL;
+
+		/* The quark may be reused for another string */
+		object_desc_forget();
 	}
 
 	/* No longer have a quark here */
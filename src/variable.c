@@ -63,6 +63,14 @@ bool arg_bigtile;	/* Command arg -- Request bigtile mode */
 bool arg_monochrome;	/* Command arg -- Request monochrome mode */
 bool arg_force_original;	/* Command arg -- Request original keyset */
 bool arg_force_roguelike;	/* Command arg -- Request roguelike keyset */
+bool arg_profile;	/* Command arg -- Time the start up */
+cptr arg_profile_json;	/* Command arg -- Write the timings here */
+cptr arg_profile_budget;	/* Command arg -- Read the budgets from here */
+
+/*
+ * Number of bytes read from files (see "fd_read()" and "my_fgets()")
+ */
+huge file_bytes_read = 0;
 
 /*
  * Various things
@@ -94,12 +102,15 @@ s16b signal_count;	/* Hack -- Count interupts */
 
 s16b o_max = 1;	/* Number of allocated objects */
 s16b o_cnt = 0;	/* Number of live objects */
+u32b o_compacted = 0;	/* Number of object list compactions */
 
 s16b m_max = 1;	/* Number of allocated monsters */
 s16b m_cnt = 0;	/* Number of live monsters */
+u32b m_compacted = 0;	/* Number of monster list compactions */
 
 s16b fld_max = 1;	/* Number of allocated fields */
 s16b fld_cnt = 0;	/* Number of live fields */
+u32b fld_compacted = 0;	/* Number of field list compactions */
 
 s16b rg_max = 1;	/* Number of allocated regions */
 s16b rg_cnt = 0;	/* Number of live regions */
@@ -127,6 +138,9 @@ byte hitpoint_warn;	/* Hitpoint warning (0 to 9) */
 
 byte delay_factor;	/* Delay factor (0 to 9) */
 
+byte window_delay;	/* Subwindow delay factor (0 to 9) */
+u32b window_saved;	/* Subwindow redraws merged by handle_stuff() */
+
 byte autosave_l;	/* Autosave before entering new levels */
 byte autosave_t;	/* Timed autosave */
 s16b autosave_freq;	/* Autosave frequency */
@@ -478,6 +492,12 @@ s16b alloc_kind_size;
  */
 alloc_entry *alloc_kind_table;
 
+/*
+ * Running totals of "prob2" in the "kind allocator table"
+ * (entry N is the sum of the first N entries)
+ */
+s32b *alloc_kind_cum;
+
 
 /*
  * The size of "alloc_race_table" (at most z_info->r_max)
@@ -489,6 +509,17 @@ s16b alloc_race_size;
  */
 alloc_entry *alloc_race_table;
 
+/*
+ * Running totals of "prob2" in the "race allocator table"
+ */
+s32b *alloc_race_cum;
+
+/*
+ * Entries in the "race allocator table" that may be rejected at
+ * the time a monster is chosen (uniques, questors and the like)
+ */
+s16b *alloc_race_check;
+
 
 /*
  * The size of the "alloc_ego_table" (at most z_info->e_max)
@@ -33,34 +33,36 @@
 
 
 /*
- * This function returns a wilderness block type that fits
- * the required parameters.
+ * The "compiled" decision tree (see compile_choice_tree()).
  *
- * The set of generation types is stored in a "decision tree"
- * - so the required time to get the wilderness type from the
- * three parameters (hgt,pop,law) is proportional to log(n).
- * This speeds up wilderness generation alot.  (Note the
- * "obvious" method of using a linear search to find matching
- * wilderness creation functions is too slow.)
+ * dt_range[][] maps a value of hgt, pop or law onto the range of
+ * values it belongs to, and dt_table[] holds the result of walking
+ * down the tree for each set of three ranges.
+ */
+static byte dt_range[4][256];
+static int dt_ranges[4];
+static u16b *dt_table = NULL;
+
+/*
+ * Hack - marks a generation type (rather than a node) in dt_table[]
+ */
+#define DT_TABLE_LEAF	0x8000
+
+
+/*
+ * Walk down the decision tree from "node", for as long as the
+ * parameters (hgt,pop,law) decide the way.
  *
- * The "type" value has two different uses.  One is to specify
- * which axis of the parameter space is being split.  The other
- * is to show whether or not a node is a terminal "leaf" node.
- * If it is a leaf node - the value returned is the number of
- * the type of wilderness generation function.
+ * This returns the wilderness generation type (with DT_TABLE_LEAF
+ * set) if a leaf is reached, or the first "random" node otherwise.
  */
-static u16b get_gen_type(byte hgt, byte pop, byte law)
+static u16b walk_choice_tree(u16b node, byte hgt, byte pop, byte law)
 {
-	/* Current node in choice tree - node zero is the "trunk" */
-	int node = 0;
-
 	/* branch of tree to go down */
 	bool branch = TRUE;
 
 	wild_choice_tree_type *tree_ptr;
 
-	/* Find matching generation type */
-
 	/* The while loop is used instead of the "obvious" recursion */
 	while (TRUE)
 	{
@@ -73,118 +75,144 @@ static u16b get_gen_type(byte hgt, byte pop, byte law)
 		 * (cutoff == 0) is used as a flag since it doesn't
 		 * split the possibility tree in any useful way.
 		 */
-		if (tree_ptr->cutoff == 0)
+		if (tree_ptr->cutoff == 0) return (node);
+
+		/*
+		 * Get lower two bits of type to decribe which of
+		 * (hgt,pop,law) cutoff refers to.
+		 */
+		switch (tree_ptr->info & 0x03)
 		{
-			/* randomly choose branch */
-			if (randint1(tree_ptr->chance1 + tree_ptr->chance2) >
-				tree_ptr->chance2)
+			case DT_HGT:
 			{
-				/* Chance1 of going "left" */
-				branch = TRUE;
+				/* Look at height */
+				branch = (tree_ptr->cutoff >= hgt);
+				break;
 			}
-			else
+			case DT_POP:
 			{
-				/* Chance2 of going "right" */
-				branch = FALSE;
+				/* Look at population */
+				branch = (tree_ptr->cutoff >= pop);
+				break;
 			}
-		}
-		else
-		{
-			/*
-			 * Get lower two bits of type to decribe which of
-			 * (hgt,pop,law) cutoff refers to.
-			 */
-			switch (tree_ptr->info & 0x03)
+			case DT_LAW:
 			{
-				case DT_HGT:
-				{
-					/* Look at height */
-					if (tree_ptr->cutoff >= hgt)
-					{
-						branch = TRUE;
-					}
-					else
-					{
-						branch = FALSE;
-					}
-
-					break;
-				}
-				case DT_POP:
-				{
-					/* Look at population */
-					if (tree_ptr->cutoff >= pop)
-					{
-						branch = TRUE;
-					}
-					else
-					{
-						branch = FALSE;
-					}
-
-					break;
-				}
-				case DT_LAW:
-				{
-					/* Look at lawfulness */
-					if (tree_ptr->cutoff >= law)
-					{
-						branch = TRUE;
-					}
-					else
-					{
-						branch = FALSE;
-					}
-
-					break;
-				}
-				default:
-				{
-					msgf("Invalid stat chosen!");
+				/* Look at lawfulness */
+				branch = (tree_ptr->cutoff >= law);
+				break;
+			}
+			default:
+			{
+				msgf("Invalid stat chosen!");
 
-					break;
-				}
+				break;
 			}
 		}
 
-
 		/* Look at the proper branch of the tree */
 		if (branch)
 		{
-			/* Go "left" */
-
-			/* See if references leaf node */
+			/* Go "left" - if the bit is set, it is a leaf */
 			if (tree_ptr->info & DT_LEFT)
 			{
-				/* If the bit is set - leaf */
-				return (tree_ptr->ptrnode1);
+				return (tree_ptr->ptrnode1 | DT_TABLE_LEAF);
 			}
-			else
+
+			node = tree_ptr->ptrnode1;
+		}
+		else
+		{
+			/* Go "right" - if the bit is set, it is a leaf */
+			if (tree_ptr->info & DT_RIGHT)
 			{
-				/* use the while loop to recurse */
-				node = tree_ptr->ptrnode1;
+				return (tree_ptr->ptrnode2 | DT_TABLE_LEAF);
 			}
+
+			node = tree_ptr->ptrnode2;
+		}
+	}
+}
+
+
+/*
+ * This function returns a wilderness block type that fits
+ * the required parameters.
+ *
+ * The set of generation types is stored in a "decision tree"
+ * - so the required time to get the wilderness type from the
+ * three parameters (hgt,pop,law) is proportional to log(n).
+ * This speeds up wilderness generation alot.  (Note the
+ * "obvious" method of using a linear search to find matching
+ * wilderness creation functions is too slow.)
+ *
+ * The "type" value has two different uses.  One is to specify
+ * which axis of the parameter space is being split.  The other
+ * is to show whether or not a node is a terminal "leaf" node.
+ * If it is a leaf node - the value returned is the number of
+ * the type of wilderness generation function.
+ *
+ * If the tree has been "compiled", the first part of the walk
+ * is just a table lookup.
+ */
+static u16b get_gen_type(byte hgt, byte pop, byte law)
+{
+	/* Current node in choice tree - node zero is the "trunk" */
+	u16b node;
+
+	/* branch of tree to go down */
+	bool branch;
+
+	wild_choice_tree_type *tree_ptr;
+
+	/* Find matching generation type */
+	if (dt_table)
+	{
+		node = dt_table[(dt_range[DT_HGT][hgt] * dt_ranges[DT_POP] +
+						 dt_range[DT_POP][pop]) * dt_ranges[DT_LAW] +
+						dt_range[DT_LAW][law]];
+	}
+	else
+	{
+		node = walk_choice_tree(0, hgt, pop, law);
+	}
+
+	/* Choose between the types in this part of parameter space */
+	while (!(node & DT_TABLE_LEAF))
+	{
+		/* Access Node */
+		tree_ptr = &wild_choice_tree[node];
+
+		/* randomly choose branch */
+		if (randint1(tree_ptr->chance1 + tree_ptr->chance2) >
+			tree_ptr->chance2)
+		{
+			/* Chance1 of going "left" */
+			branch = TRUE;
 		}
 		else
 		{
-			/* Go "right" */
+			/* Chance2 of going "right" */
+			branch = FALSE;
+		}
 
+		/* Look at the proper branch of the tree */
+		if (branch)
+		{
 			/* See if references leaf node */
-			if (tree_ptr->info & DT_RIGHT)
-			{
-				/* If the bit is set - leaf */
-				return (tree_ptr->ptrnode2);
-			}
-			else
-			{
-				/* use the while loop to recurse */
-				node = tree_ptr->ptrnode2;
-			}
+			if (tree_ptr->info & DT_LEFT) return (tree_ptr->ptrnode1);
+
+			node = walk_choice_tree(tree_ptr->ptrnode1, hgt, pop, law);
+		}
+		else
+		{
+			/* See if references leaf node */
+			if (tree_ptr->info & DT_RIGHT) return (tree_ptr->ptrnode2);
+
+			node = walk_choice_tree(tree_ptr->ptrnode2, hgt, pop, law);
 		}
 	}
 
-	/* For some dumb compilers */
-	return (0);
+	return (node & ~DT_TABLE_LEAF);
 }
 
 
@@ -1444,6 +1472,79 @@ u16b add_node_tree_root(wild_bound_box_type *bound, u16b type)
 }
 
 
+/*
+ * "Compile" the decision tree into a lookup table.
+ *
+ * The cutoffs in the tree split each of (hgt,pop,law) into a few
+ * ranges of values.  Every value in a range goes the same way at
+ * every node, so the walk down the tree only depends on the three
+ * ranges.  (With the current w_info.txt there are 7 ranges on
+ * each axis, so the table is tiny.)
+ *
+ * The walk stops at the first "random" node, since that must be
+ * done again each time.
+ */
+static void compile_choice_tree(void)
+{
+	bool cut[4][256];
+	byte first[4][256];
+
+	int i, axis, v;
+	int h, p, l;
+
+	wild_choice_tree_type *tree_ptr;
+
+	/* Forget the old table */
+	KILL(dt_table);
+
+	/* Find the cutoffs on each axis */
+	(void)C_WIPE(cut, 4 * 256, bool);
+
+	for (i = 0; i < d_tree_count; i++)
+	{
+		tree_ptr = &wild_choice_tree[i];
+
+		/* Ignore the "random" nodes */
+		if (!tree_ptr->cutoff) continue;
+
+		cut[tree_ptr->info & 0x03][tree_ptr->cutoff] = TRUE;
+	}
+
+	/* Split each axis into ranges */
+	for (axis = DT_HGT; axis <= DT_LAW; axis++)
+	{
+		dt_ranges[axis] = 0;
+
+		for (v = 0; v < 256; v++)
+		{
+			/* Remember the first value in each range */
+			if (!v || cut[axis][v - 1]) first[axis][dt_ranges[axis]++] = v;
+
+			/* A cutoff of "v" sends "v" left and "v + 1" right */
+			dt_range[axis][v] = dt_ranges[axis] - 1;
+		}
+	}
+
+	/* Make the table */
+	C_MAKE(dt_table, dt_ranges[DT_HGT] * dt_ranges[DT_POP] *
+		   dt_ranges[DT_LAW], u16b);
+
+	/* Walk the tree for each set of ranges */
+	for (h = 0; h < dt_ranges[DT_HGT]; h++)
+	{
+		for (p = 0; p < dt_ranges[DT_POP]; p++)
+		{
+			for (l = 0; l < dt_ranges[DT_LAW]; l++)
+			{
+				dt_table[(h * dt_ranges[DT_POP] + p) * dt_ranges[DT_LAW] + l] =
+					walk_choice_tree(0, first[DT_HGT][h], first[DT_POP][p],
+									 first[DT_LAW][l]);
+			}
+		}
+	}
+}
+
+
 /*
  * Debug code for the wilderness decision tree.
  */
@@ -3325,8 +3426,15 @@ static void create_wild_info(int *bestx, int *besty)
 			/* No info flags set yet */
 			w_ptr->trans.info = 0;
 
-			/* How good is this spot to put a town? */
-			if ((law > 230) && (hgt > 160))
+			/*
+			 * How good is this spot to put a town?
+			 *
+			 * Hack - the town (8x8 blocks) must also be two blocks
+			 * away from the edge, or blank_spot() will reject it.
+			 */
+			if ((law > 230) && (hgt > 160) &&
+				(i >= 2) && (i < max_wild - 10) &&
+				(j >= 2) && (j < max_wild - 10))
 			{
 				/* Hack - Only record the first such place */
 				if ((x == -1) && (y == -1))
@@ -3537,6 +3645,9 @@ void create_wilderness(void)
 		/* Create the height, population, and law info */
 		create_wild_info(&x, &y);
 
+		/* Nowhere for the starting town - don't bother with the rest */
+		if (x < 0) continue;
+
 		/*
 		 * Add in large level features.
 		 */
@@ -3558,6 +3669,9 @@ void create_wilderness(void)
 	 * Finish everything off
 	 */
 
+	/* Speed up the decision tree */
+	compile_choice_tree();
+
 	/* Convert the wilderness into the final data structure */
 	create_terrain();
 
@@ -3569,6 +3683,7 @@ void create_wilderness(void)
 
 	/* Free up memory used to create the wilderness */
 	FREE(wild_choice_tree);
+	KILL(dt_table);
 
 #endif /* !DEBUG */
 
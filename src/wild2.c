@@ -1369,7 +1369,7 @@ static void entrance_monsters(int x_max, int y_max)
 	if (!dun_habitat) return;
 	
 	/* Apply the monster restriction */
-	get_mon_num_prep(monster_habitat_ok);
+	get_mon_num_prep_key(monster_habitat_ok, dun_habitat);
 
 	for (i = 0; i < count; i++)
 	{
@@ -103,6 +103,164 @@ static void do_cmd_wiz_hack_ben(void)
 
 
 
+/*
+ * Show how full the object, monster and field lists are
+ */
+static void do_cmd_wiz_lists(void)
+{
+	msgf("Objects: %d live, %d used, %d max, %lu compactions.",
+		 (int)o_cnt, (int)o_max - 1, (int)z_info->o_max - 1,
+		 (unsigned long)o_compacted);
+	msgf("Monsters: %d live, %d used, %d max, %lu compactions.",
+		 (int)m_cnt, (int)m_max - 1, (int)z_info->m_max - 1,
+		 (unsigned long)m_compacted);
+	msgf("Fields: %d live, %d used, %d max, %lu compactions.",
+		 (int)fld_cnt, (int)fld_max - 1, (int)z_info->fld_max - 1,
+		 (unsigned long)fld_compacted);
+}
+
+
+/*
+ * Show (and reset) the map redraw statistics.
+ *
+ * Used to measure the cost of drawing the map: stand somewhere busy,
+ * use this once to start counting, wait a while, and use it again.
+ */
+static void do_cmd_wiz_redraw_stats(void)
+{
+	static s32b last_turn = 0;
+
+	s32b turns = turn - last_turn;
+
+	msgf("Map: %lu full and %lu partial redraws, %lu grids in %ld game turns.",
+		 (unsigned long)map_full_redraws, (unsigned long)map_spot_redraws,
+		 (unsigned long)map_grids_redrawn, (long)turns);
+
+	if (turns >= 10)
+	{
+		msgf("That is %lu grids per player turn (at normal speed).",
+			 (unsigned long)(map_grids_redrawn / (turns / 10)));
+	}
+
+	/* Start again */
+	map_full_redraws = 0;
+	map_spot_redraws = 0;
+	map_grids_redrawn = 0;
+	last_turn = turn;
+}
+
+
+/*
+ * The screen recording (if any)
+ */
+static FILE *wiz_rec_file = NULL;
+
+
+/*
+ * Start or stop recording everything drawn on the main screen.
+ */
+static void do_cmd_wiz_record(void)
+{
+	char name[80];
+	char buf[1024];
+
+	/* Stop recording */
+	if (wiz_rec_file)
+	{
+		/* Make sure the last frame is in it */
+		Term_fresh();
+
+		(void)Term_record(NULL);
+		my_fclose(wiz_rec_file);
+		wiz_rec_file = NULL;
+
+		msgf("Stopped recording the screen.");
+		return;
+	}
+
+	/* Default file */
+	strcpy(name, "screen.rec");
+
+	if (!get_string(name, 80, "Record to file: ")) return;
+
+	path_make(buf, ANGBAND_DIR_USER, name);
+
+	wiz_rec_file = my_fopen(buf, "wb");
+
+	if (!wiz_rec_file)
+	{
+		msgf("Cannot open %s.", buf);
+		return;
+	}
+
+	(void)Term_record(wiz_rec_file);
+
+	msgf("Recording the screen to %s.", buf);
+}
+
+
+/*
+ * Replay a screen recording at full speed, to time the display code.
+ * Takes a command count (the number of times to play it).
+ */
+static void do_cmd_wiz_replay(int num)
+{
+	char name[80];
+	char buf[1024];
+
+	FILE *fff;
+
+	int i, frames = 0;
+	errr err = 0;
+
+	clock_t start, ticks;
+
+	/* Default file */
+	strcpy(name, "screen.rec");
+
+	if (!get_string(name, 80, "Replay file: ")) return;
+
+	path_make(buf, ANGBAND_DIR_USER, name);
+
+	fff = my_fopen(buf, "rb");
+
+	if (!fff)
+	{
+		msgf("Cannot open %s.", buf);
+		return;
+	}
+
+	screen_save();
+
+	start = clock();
+
+	for (i = 0; (i < num) && !err; i++)
+	{
+		/* Start again */
+		rewind(fff);
+
+		err = Term_replay(fff, &frames);
+	}
+
+	ticks = clock() - start;
+
+	my_fclose(fff);
+
+	screen_load();
+
+	if (err) msgf("The recording is corrupt.");
+
+	msgf("Replayed %d frames in %ld ms of processor time.", frames,
+		 (long)(ticks * 1000 / CLOCKS_PER_SEC));
+
+	if (ticks)
+	{
+		msgf("That is %ld frames per second.",
+			 (long)(frames * (long)CLOCKS_PER_SEC / ticks));
+	}
+}
+
+
 #ifdef MONSTER_HORDES
 
 /* Summon a horde of monsters */
@@ -1786,6 +1944,20 @@ void do_cmd_debug(void)
 			break;
 		}
 
+		case 'R':
+		{
+			/* Show the map redraw statistics */
+			do_cmd_wiz_redraw_stats();
+			break;
+		}
+
+		case 'S':
+		{
+			/* Show the list statistics */
+			do_cmd_wiz_lists();
+			break;
+		}
+
 		case 't':
 		{
 			/* Teleport */
@@ -1869,6 +2041,21 @@ void do_cmd_debug(void)
 			break;
 		}
 
+		case 'y':
+		{
+			/* Start or stop recording the screen */
+			do_cmd_wiz_record();
+			break;
+		}
+
+		case 'Y':
+		{
+			/* Replay a screen recording */
+			if (p_ptr->cmd.arg <= 0) p_ptr->cmd.arg = 1;
+			do_cmd_wiz_replay(p_ptr->cmd.arg);
+			break;
+		}
+
 		case 'Z':
 		{
 			do_cmd_wiz_zap_all();
@@ -2469,84 +2469,160 @@ void object_bonuses_known(const object_type *o_ptr, bonuses_type *b)
 
 
 /*
- * Calculate the players current "state", taking into account
- * not only race/class intrinsics, but also objects being worn
- * and temporary spell effects.
- *
- * See also calc_mana() and calc_hitpoints().
- *
- * Take note of the new "speed code", in particular, a very strong
- * player will start slowing down as soon as he reaches 150 pounds,
- * but not until he reaches 450 pounds will he be half as fast as
- * a normal kobold.  This both hurts and helps the player, hurts
- * because in the old days a player could just avoid 300 pounds,
- * and helps because now carrying 300 pounds is not very painful.
- *
- * The "weapon" and "bow" do *not* add to the bonuses to hit or to
- * damage, since that would affect non-combat things.  These values
- * are actually added in later, at the appropriate place.
- *
- * This function induces various "status" messages.
+ * The bonuses from one source, as added up by calc_bonuses()
  */
-static void calc_bonuses(void)
+typedef struct bonus_part bonus_part;
+
+struct bonus_part
 {
-	int i, j, hold;
-	int old_speed;
-	bool old_telepathy;
-	bool old_see_inv;
-	int old_dis_ac;
-	int old_dis_to_a;
+	u32b flags[4];
+	int stat[A_MAX];
+	int skills[MAX_SKILL];
+	int ac, dis_ac;
+	int to_a, dis_to_a;
+	int to_h, dis_to_h;
+	int to_d, dis_to_d;
+	int pspeed;
+	int sp_bonus;
+	int see_infra;
 	int extra_blows;
 	int extra_shots;
-	object_type *o_ptr;
+};
 
-	bool old_heavy_wield = p_ptr->state.heavy_wield;
-	bool old_heavy_shoot = p_ptr->state.heavy_shoot;
-	bool old_icky_wield = p_ptr->state.icky_wield;
-	bool old_monk_armour = p_ptr->state.monk_armour_stat;
 
-	object_flags oflags;
-	object_flags *of_ptr = &oflags;
+/*
+ * Hack -- calc_bonuses() is called whenever anything about the player
+ * changes, such as a timed effect running out.  Most of the time the
+ * race, class, mutations and equipment are just as they were, so the
+ * bonuses from each of those are remembered along with what they were
+ * worked out from, and only the ones that have changed are redone.
+ */
 
-	/* Save the old speed */
-	old_speed = p_ptr->pspeed;
+/* Racial, class and mutation bonuses */
+static bonus_part bonus_innate;
+static bool bonus_innate_valid = FALSE;
+static byte bonus_innate_race;
+static byte bonus_innate_class;
+static s16b bonus_innate_lev;
+static u32b bonus_innate_muta1;
+static u32b bonus_innate_muta2;
+static u32b bonus_innate_muta3;
+static bool bonus_innate_monk;
+
+/* Bonuses from each equipment slot */
+static bonus_part bonus_equip[EQUIP_MAX];
+static bool bonus_equip_valid[EQUIP_MAX];
+static object_type bonus_equip_obj[EQUIP_MAX];
+static bool bonus_equip_known[EQUIP_MAX];
+static byte bonus_equip_class;
+static s16b bonus_equip_lev;
 
-	/* Save the old vision stuff */
-	old_telepathy = FLAG(p_ptr, TR_TELEPATHY) ? TRUE : FALSE;
-	old_see_inv = FLAG(p_ptr, TR_SEE_INVIS) ? TRUE : FALSE;
 
-	/* Save the old armor class */
-	old_dis_ac = p_ptr->dis_ac;
-	old_dis_to_a = p_ptr->dis_to_a;
+/*
+ * Copy the bonuses in "p_ptr" into a part
+ */
+static void bonus_save(bonus_part *bp)
+{
+	int i;
 
+	for (i = 0; i < 4; i++) bp->flags[i] = p_ptr->flags[i];
+	for (i = 0; i < A_MAX; i++) bp->stat[i] = p_ptr->stat[i].add;
+	for (i = 0; i < MAX_SKILL; i++) bp->skills[i] = p_ptr->skills[i];
+
+	bp->ac = p_ptr->ac;
+	bp->dis_ac = p_ptr->dis_ac;
+	bp->to_a = p_ptr->to_a;
+	bp->dis_to_a = p_ptr->dis_to_a;
+	bp->to_h = p_ptr->to_h;
+	bp->dis_to_h = p_ptr->dis_to_h;
+	bp->to_d = p_ptr->to_d;
+	bp->dis_to_d = p_ptr->dis_to_d;
+	bp->pspeed = p_ptr->pspeed;
+	bp->sp_bonus = p_ptr->sp_bonus;
+	bp->see_infra = p_ptr->see_infra;
+	bp->extra_blows = 0;
+	bp->extra_shots = 0;
+}
 
-	/* Clear extra blows/shots */
-	extra_blows = extra_shots = 0;
 
-	/* Calculate monk armour status */
-	if (p_ptr->rp.pclass == CLASS_MONK)
-	{
-		u16b monk_arm_wgt = 0;
+/*
+ * Replace the bonuses in "p_ptr" with a part
+ */
+static void bonus_load(const bonus_part *bp)
+{
+	int i;
 
-		/* Weigh the armor */
-		monk_arm_wgt += p_ptr->equipment[EQUIP_BODY].weight;
-		monk_arm_wgt += p_ptr->equipment[EQUIP_HEAD].weight;
-		monk_arm_wgt += p_ptr->equipment[EQUIP_ARM].weight;
-		monk_arm_wgt += p_ptr->equipment[EQUIP_OUTER].weight;
-		monk_arm_wgt += p_ptr->equipment[EQUIP_HANDS].weight;
-		monk_arm_wgt += p_ptr->equipment[EQUIP_FEET].weight;
+	for (i = 0; i < 4; i++) p_ptr->flags[i] = bp->flags[i];
+	for (i = 0; i < A_MAX; i++) p_ptr->stat[i].add = bp->stat[i];
+	for (i = 0; i < MAX_SKILL; i++) p_ptr->skills[i] = bp->skills[i];
+
+	p_ptr->ac = bp->ac;
+	p_ptr->dis_ac = bp->dis_ac;
+	p_ptr->to_a = bp->to_a;
+	p_ptr->dis_to_a = bp->dis_to_a;
+	p_ptr->to_h = bp->to_h;
+	p_ptr->dis_to_h = bp->dis_to_h;
+	p_ptr->to_d = bp->to_d;
+	p_ptr->dis_to_d = bp->dis_to_d;
+	p_ptr->pspeed = bp->pspeed;
+	p_ptr->sp_bonus = bp->sp_bonus;
+	p_ptr->see_infra = bp->see_infra;
+}
 
-		if (monk_arm_wgt > (100 + (p_ptr->lev * 4)))
-		{
-			/* Burdened */
-			p_ptr->state.monk_armour_stat = TRUE;
-		}
-		else
-		{
-			/* Not burdened */
-			p_ptr->state.monk_armour_stat = FALSE;
-		}
-	}
+
+/*
+ * Add a part to the bonuses in "p_ptr"
+ */
+static void bonus_add(const bonus_part *bp)
+{
+	int i;
+
+	for (i = 0; i < 4; i++) p_ptr->flags[i] |= bp->flags[i];
+	for (i = 0; i < A_MAX; i++) p_ptr->stat[i].add += bp->stat[i];
+	for (i = 0; i < MAX_SKILL; i++) p_ptr->skills[i] += bp->skills[i];
+
+	p_ptr->ac += bp->ac;
+	p_ptr->dis_ac += bp->dis_ac;
+	p_ptr->to_a += bp->to_a;
+	p_ptr->dis_to_a += bp->dis_to_a;
+	p_ptr->to_h += bp->to_h;
+	p_ptr->dis_to_h += bp->dis_to_h;
+	p_ptr->to_d += bp->to_d;
+	p_ptr->dis_to_d += bp->dis_to_d;
+	p_ptr->pspeed += bp->pspeed;
+	p_ptr->sp_bonus += bp->sp_bonus;
+	p_ptr->see_infra += bp->see_infra;
+}
+
+
+/*
+ * Are the remembered racial, class and mutation bonuses still good?
+ */
+static bool bonus_innate_ok(void)
+{
+	if (!bonus_innate_valid) return (FALSE);
+
+	if (bonus_innate_race != p_ptr->rp.prace) return (FALSE);
+	if (bonus_innate_class != p_ptr->rp.pclass) return (FALSE);
+	if (bonus_innate_lev != p_ptr->lev) return (FALSE);
+	if (bonus_innate_muta1 != p_ptr->muta1) return (FALSE);
+	if (bonus_innate_muta2 != p_ptr->muta2) return (FALSE);
+	if (bonus_innate_muta3 != p_ptr->muta3) return (FALSE);
+	if (bonus_innate_monk != p_ptr->state.monk_armour_stat) return (FALSE);
+
+	return (TRUE);
+}
+
+
+/*
+ * Work out the racial, class and mutation bonuses, and remember them
+ */
+static void calc_innate(void)
+{
+	int i;
+
+	object_flags oflags;
+	object_flags *of_ptr = &oflags;
 
 	/* Clear the stat modifiers */
 	for (i = 0; i < A_MAX; i++) p_ptr->stat[i].add = 0;
@@ -2566,15 +2642,6 @@ static void calc_bonuses(void)
 	/* Start with "normal" mana */
 	p_ptr->sp_bonus = 0;
 
-	/* Start with a single blow per turn */
-	p_ptr->num_blow = 1;
-
-	/* Start with a single shot per turn */
-	p_ptr->num_fire = 1;
-
-	/* Reset the "ammo" tval */
-	p_ptr->ammo_tval = 0;
-
 	/* Clear all the flags */
 	p_ptr->flags[0] = 0;
 	p_ptr->flags[1] = 0;
@@ -2636,71 +2703,259 @@ static void calc_bonuses(void)
 		mutation_effect();
 	}
 
-	/* Scan the usable inventory */
-	for (i = 0; i < EQUIP_MAX; i++)
+	/* Golems also get an intrinsic AC bonus */
+	if (p_ptr->rp.prace == RACE_GOLEM)
 	{
-		bonuses_type b;
+		p_ptr->to_a += 20 + (p_ptr->lev / 5);
+		p_ptr->dis_to_a += 20 + (p_ptr->lev / 5);
+	}
 
-		o_ptr = &p_ptr->equipment[i];
+	/* Remember the bonuses */
+	bonus_save(&bonus_innate);
 
-		/* Skip non-objects */
-		if (!o_ptr->k_idx) continue;
-		
-		p_ptr->flags[0] |= o_ptr->flags[0];
-		p_ptr->flags[1] |= o_ptr->flags[1];
-		p_ptr->flags[2] |= o_ptr->flags[2];
-		p_ptr->flags[3] |= o_ptr->flags[3];
+	/* Remember what they depend on */
+	bonus_innate_race = p_ptr->rp.prace;
+	bonus_innate_class = p_ptr->rp.pclass;
+	bonus_innate_lev = p_ptr->lev;
+	bonus_innate_muta1 = p_ptr->muta1;
+	bonus_innate_muta2 = p_ptr->muta2;
+	bonus_innate_muta3 = p_ptr->muta3;
+	bonus_innate_monk = p_ptr->state.monk_armour_stat;
+
+	bonus_innate_valid = TRUE;
+}
+
+
+/*
+ * Are the remembered bonuses for an equipment slot still good?
+ */
+static bool bonus_equip_ok(int slot)
+{
+	object_type *o_ptr = &p_ptr->equipment[slot];
+
+	/* Some artifacts depend on the level and class */
+	if ((bonus_equip_lev != p_ptr->lev) ||
+		(bonus_equip_class != p_ptr->rp.pclass))
+	{
+		/* Forget all the slots */
+		(void)C_WIPE(bonus_equip_valid, EQUIP_MAX, bool);
+
+		bonus_equip_lev = p_ptr->lev;
+		bonus_equip_class = p_ptr->rp.pclass;
+
+		return (FALSE);
+	}
+
+	if (!bonus_equip_valid[slot]) return (FALSE);
+
+	/* Has the object changed? */
+	if (memcmp(&bonus_equip_obj[slot], o_ptr, sizeof(object_type)))
+	{
+		return (FALSE);
+	}
+
+	/* Flavours can become known */
+	if (bonus_equip_known[slot] != (object_known_p(o_ptr) ? TRUE : FALSE))
+	{
+		return (FALSE);
+	}
+
+	return (TRUE);
+}
+
+
+/*
+ * Work out the bonuses for an equipment slot, and remember them
+ */
+static void calc_equip_part(int slot, bonus_part *bp)
+{
+	object_type *o_ptr = &p_ptr->equipment[slot];
+
+	bonuses_type b;
+
+	int j;
+
+	bool known = object_known_p(o_ptr) ? TRUE : FALSE;
+
+	/* Remember what the bonuses depend on */
+	COPY(&bonus_equip_obj[slot], o_ptr, object_type);
+	bonus_equip_known[slot] = known;
+	bonus_equip_valid[slot] = TRUE;
+
+	/* Clear the bonuses */
+	(void)WIPE(bp, bonus_part);
+
+	/* Skip non-objects */
+	if (!o_ptr->k_idx) return;
+
+	bp->flags[0] = o_ptr->flags[0];
+	bp->flags[1] = o_ptr->flags[1];
+	bp->flags[2] = o_ptr->flags[2];
+	bp->flags[3] = o_ptr->flags[3];
+
+	/* Calculate bonuses from object */
+	object_bonuses(o_ptr, &b);
+
+	/* Modify the base armor class */
+	bp->ac = o_ptr->ac;
+
+	/* The base armor class is always known */
+	bp->dis_ac = o_ptr->ac;
+
+	/* Apply bonuses to stats */
+	for (j = 0; j < A_MAX; j++)
+	{
+		bp->stat[j] = b.stat[j];
+	}
+
+	bp->sp_bonus = b.sp_bonus;
+	bp->see_infra = b.see_infra;
+	bp->pspeed = b.pspeed;
+	bp->extra_blows = b.extra_blows;
+	bp->extra_shots = b.extra_shots;
+
+	/* Apply bonuses to skills */
+	for (j = 0; j < MAX_SKILL; j++)
+	{
+		bp->skills[j] = b.skills[j];
+	}
+
+	/* Apply the bonuses to armor class */
+	bp->to_a = o_ptr->to_a;
+
+	/* Apply the mental bonuses to armor class, if known */
+	if (known) bp->dis_to_a = o_ptr->to_a;
 
-		/* Calculate bonuses from object */
-		object_bonuses(o_ptr, &b);
+	/* amulet of sustenance */
+	if (o_ptr->tval == TV_AMULET && o_ptr->sval == SV_AMULET_SUSTENANCE)
+		SET_FLAG(bp, TR_SUSTENANCE);
 
-		/* Modify the base armor class */
-		p_ptr->ac += o_ptr->ac;
+	/* Hack -- do not apply "weapon" bonuses */
+	if (slot == EQUIP_WIELD) return;
 
-		/* The base armor class is always known */
-		p_ptr->dis_ac += o_ptr->ac;
+	/* Hack -- do not apply "bow" bonuses */
+	if (slot == EQUIP_BOW) return;
 
-		/* Apply bonuses to stats */
-		for (j = 0; j < A_MAX; j++)
+	/* Apply the bonuses to hit/damage */
+	bp->to_h = o_ptr->to_h;
+	bp->to_d = o_ptr->to_d;
+
+	/* Apply the mental bonuses tp hit/damage, if known */
+	if (known) bp->dis_to_h = o_ptr->to_h;
+	if (known) bp->dis_to_d = o_ptr->to_d;
+}
+
+
+/*
+ * Calculate the players current "state", taking into account
+ * not only race/class intrinsics, but also objects being worn
+ * and temporary spell effects.
+ *
+ * See also calc_mana() and calc_hitpoints().
+ *
+ * Take note of the new "speed code", in particular, a very strong
+ * player will start slowing down as soon as he reaches 150 pounds,
+ * but not until he reaches 450 pounds will he be half as fast as
+ * a normal kobold.  This both hurts and helps the player, hurts
+ * because in the old days a player could just avoid 300 pounds,
+ * and helps because now carrying 300 pounds is not very painful.
+ *
+ * The "weapon" and "bow" do *not* add to the bonuses to hit or to
+ * damage, since that would affect non-combat things.  These values
+ * are actually added in later, at the appropriate place.
+ *
+ * This function induces various "status" messages.
+ */
+static void calc_bonuses(void)
+{
+	int i, j, hold;
+	int old_speed;
+	bool old_telepathy;
+	bool old_see_inv;
+	int old_dis_ac;
+	int old_dis_to_a;
+	int extra_blows;
+	int extra_shots;
+	object_type *o_ptr;
+
+	bool old_heavy_wield = p_ptr->state.heavy_wield;
+	bool old_heavy_shoot = p_ptr->state.heavy_shoot;
+	bool old_icky_wield = p_ptr->state.icky_wield;
+	bool old_monk_armour = p_ptr->state.monk_armour_stat;
+
+	/* Save the old speed */
+	old_speed = p_ptr->pspeed;
+
+	/* Save the old vision stuff */
+	old_telepathy = FLAG(p_ptr, TR_TELEPATHY) ? TRUE : FALSE;
+	old_see_inv = FLAG(p_ptr, TR_SEE_INVIS) ? TRUE : FALSE;
+
+	/* Save the old armor class */
+	old_dis_ac = p_ptr->dis_ac;
+	old_dis_to_a = p_ptr->dis_to_a;
+
+	/* Calculate monk armour status */
+	if (p_ptr->rp.pclass == CLASS_MONK)
+	{
+		u16b monk_arm_wgt = 0;
+
+		/* Weigh the armor */
+		monk_arm_wgt += p_ptr->equipment[EQUIP_BODY].weight;
+		monk_arm_wgt += p_ptr->equipment[EQUIP_HEAD].weight;
+		monk_arm_wgt += p_ptr->equipment[EQUIP_ARM].weight;
+		monk_arm_wgt += p_ptr->equipment[EQUIP_OUTER].weight;
+		monk_arm_wgt += p_ptr->equipment[EQUIP_HANDS].weight;
+		monk_arm_wgt += p_ptr->equipment[EQUIP_FEET].weight;
+
+		if (monk_arm_wgt > (100 + (p_ptr->lev * 4)))
 		{
-			p_ptr->stat[j].add += b.stat[j];
+			/* Burdened */
+			p_ptr->state.monk_armour_stat = TRUE;
 		}
-		
-		p_ptr->sp_bonus += b.sp_bonus;
-		p_ptr->see_infra += b.see_infra;
-		p_ptr->pspeed += b.pspeed;
-		extra_blows += b.extra_blows;
-		extra_shots += b.extra_shots;
-
-		/* Apply bonuses to skills */
-		for (j = 0; j < MAX_SKILL; j++)
+		else
 		{
-			p_ptr->skills[j] += b.skills[j];
+			/* Not burdened */
+			p_ptr->state.monk_armour_stat = FALSE;
 		}
+	}
+
+	/* Start with a single blow per turn */
+	p_ptr->num_blow = 1;
+
+	/* Start with a single shot per turn */
+	p_ptr->num_fire = 1;
 
-		/* Apply the bonuses to armor class */
-		p_ptr->to_a += o_ptr->to_a;
+	/* Reset the "ammo" tval */
+	p_ptr->ammo_tval = 0;
 
-		/* Apply the mental bonuses to armor class, if known */
-		if (object_known_p(o_ptr)) p_ptr->dis_to_a += o_ptr->to_a;
+	/* Racial, class and mutation bonuses */
+	if (bonus_innate_ok())
+	{
+		/* Use the old ones */
+		bonus_load(&bonus_innate);
+	}
+	else
+	{
+		/* Work them out again */
+		calc_innate();
+	}
 
-		/* Hack -- do not apply "weapon" bonuses */
-		if (i == EQUIP_WIELD) continue;
+	/* Clear extra blows/shots */
+	extra_blows = extra_shots = 0;
 
-		/* Hack -- do not apply "bow" bonuses */
-		if (i == EQUIP_BOW) continue;
+	/* Scan the usable inventory */
+	for (i = 0; i < EQUIP_MAX; i++)
+	{
+		bonus_part *bp = &bonus_equip[i];
 
-		/* Apply the bonuses to hit/damage */
-		p_ptr->to_h += o_ptr->to_h;
-		p_ptr->to_d += o_ptr->to_d;
+		/* Only look at objects that have changed */
+		if (!bonus_equip_ok(i)) calc_equip_part(i, bp);
 
-		/* Apply the mental bonuses tp hit/damage, if known */
-		if (object_known_p(o_ptr)) p_ptr->dis_to_h += o_ptr->to_h;
-		if (object_known_p(o_ptr)) p_ptr->dis_to_d += o_ptr->to_d;
+		/* Add it in */
+		bonus_add(bp);
 
-		/* amulet of sustenance */
-		if (o_ptr->tval == TV_AMULET && o_ptr->sval == SV_AMULET_SUSTENANCE)
-			SET_FLAG(p_ptr, TR_SUSTENANCE);
+		extra_blows += bp->extra_blows;
+		extra_shots += bp->extra_shots;
 	}
 
 	/* Monks get extra ac for armour _not worn_ */
@@ -2741,13 +2996,6 @@ static void calc_bonuses(void)
 	/* Hack -- aura of fire also provides light */
 	if (FLAG(p_ptr, TR_SH_FIRE)) SET_FLAG(p_ptr, TR_LITE);
 
-	/* Golems also get an intrinsic AC bonus */
-	if (p_ptr->rp.prace == RACE_GOLEM)
-	{
-		p_ptr->to_a += 20 + (p_ptr->lev / 5);
-		p_ptr->dis_to_a += 20 + (p_ptr->lev / 5);
-	}
-
 	/* Calculate stats */
 	for (i = 0; i < A_MAX; i++)
 	{
@@ -3503,12 +3751,8 @@ void update_stuff(void)
 	{
 		p_ptr->update &= ~(PU_MON_LITE);
 		update_mon_lite();
-		
-		/*
-		 * Hack - the odds are that since monsters moved, 
-		 * we need to redraw the map.
-		 */
-		p_ptr->redraw |= (PR_MAP);
+
+		/* The grids that changed have been queued for redrawing */
 		p_ptr->update |= (PU_VIEW);
 	}
 
@@ -3734,23 +3978,38 @@ void redraw_stuff(void)
 	
 	if (p_ptr->redraw & (PR_MAP))
 	{
-		p_ptr->redraw &= ~(PR_MAP);
+		p_ptr->redraw &= ~(PR_MAP | PR_MAP_SPOTS);
 		prt_map();
 	}
+
+	if (p_ptr->redraw & (PR_MAP_SPOTS))
+	{
+		p_ptr->redraw &= ~(PR_MAP_SPOTS);
+		prt_map_spots();
+	}
 }
 
 
 /*
- * Handle "p_ptr->window"
+ * Subwindow redraws put off by handle_stuff()
  */
-void window_stuff(void)
+static u32b window_pend = 0L;
+
+/*
+ * Time of the last subwindow redraw (see time_usec())
+ */
+static u32b window_usec = 0;
+
+
+/*
+ * Get the "p_ptr->window" flags which will actually be drawn
+ */
+static u32b window_usable(void)
 {
 	int j;
 
-	u32b mask = 0L;
-
-	/* Nothing to do */
-	if (!p_ptr->window) return;
+	/* The inventory and equipment are always sent to the ports */
+	u32b mask = (PW_INVEN | PW_EQUIP);
 
 	/* Scan windows */
 	for (j = 0; j < ANGBAND_TERM_MAX; j++)
@@ -3759,6 +4018,73 @@ void window_stuff(void)
 		if (angband_term[j]) mask |= window_flag[j];
 	}
 
+	return (mask);
+}
+
+
+/*
+ * Is it time to redraw the subwindows?
+ *
+ * The "window_delay" value (0 to 9), cubed, is the shortest time in
+ * milliseconds between two subwindow redraws.  Zero redraws them every
+ * time handle_stuff() is called, as before.
+ *
+ * The game always catches up before it waits for a key, see
+ * frame_stuff().
+ */
+static bool window_due(void)
+{
+	u32b msec = window_delay * window_delay * window_delay;
+
+	/* No delay */
+	if (!msec) return (TRUE);
+
+	return ((time_usec() - window_usec) >= msec * 1000);
+}
+
+
+/*
+ * Put off the "p_ptr->window" redraws until later
+ */
+static void window_defer(void)
+{
+	u32b flags = p_ptr->window & window_pend & window_usable();
+
+	/* Count the redraws which are merged into one */
+	while (flags)
+	{
+		/* Remove the lowest bit */
+		flags &= flags - 1;
+
+		window_saved++;
+	}
+
+	/* Remember what to draw */
+	window_pend |= p_ptr->window;
+	p_ptr->window = 0L;
+}
+
+
+/*
+ * Handle "p_ptr->window"
+ */
+void window_stuff(void)
+{
+	u32b mask;
+
+	/* Catch up on any redraws that were put off */
+	p_ptr->window |= window_pend;
+	window_pend = 0L;
+
+	/* Nothing to do */
+	if (!p_ptr->window) return;
+
+	/* Remember when this was done */
+	window_usec = time_usec();
+
+	/* Get usable flags */
+	mask = window_usable();
+
 	/* Display inventory */
 	if (p_ptr->window & (PW_INVEN))
 	{
@@ -3851,7 +4177,29 @@ void handle_stuff(void)
 	if (p_ptr->redraw) redraw_stuff();
 
 	/* Window stuff */
-	if (p_ptr->window) window_stuff();
+	if (p_ptr->window)
+	{
+		/* Merge the subwindow redraws, if asked to */
+		if (window_due()) window_stuff();
+		else window_defer();
+	}
+}
+
+
+/*
+ * Draw anything that handle_stuff() has put off.
+ *
+ * This is called just before the screen is shown to the player
+ * (before waiting for a key, and when flushing the output after
+ * each game turn) so the subwindows are never out of date then.
+ */
+void frame_stuff(void)
+{
+	/* Nothing to do */
+	if (!window_pend) return;
+
+	/* Draw the subwindows */
+	window_stuff();
 }
 
 /*
@@ -344,6 +344,17 @@
 #endif /* SET_UID */
 
 
+/*
+ * OPTION: Write autosaves from a forked copy of the game, so that the
+ * player can keep playing while the savefile is written.  The child
+ * process gets a consistent (copy-on-write) snapshot of the game.
+ * This option is only relevant on SET_UID machines.
+ */
+#ifdef SET_UID
+#define BACKGROUND_AUTOSAVE
+#endif /* SET_UID */
+
+
 /*
  * OPTION: Capitalize the "user_name" (for "default" player name)
  * This option is only relevant on SET_UID machines.
@@ -0,0 +1,286 @@
+/* File: z-pack.c */
+
+/*
+ * Copyright (c) The Zangband DevTeam
+ *
+ * This software may be copied and distributed for educational, research,
+ * and not for profit purposes provided that this copyright and statement
+ * are included in all such copies.
+ */
+
+/* Purpose: Fast block compression for savefiles */
+
+#include "z-pack.h"
+
+
+/*
+ * A packed block is a list of "sequences".  Each sequence is a token
+ * byte, followed by a run of literal bytes, followed by a back-reference
+ * into the data that has already been unpacked:
+ *
+ *   token:    high nibble = literal count, low nibble = match length - 4
+ *   (extra literal count bytes, if the high nibble is 15)
+ *   literals
+ *   offset:   two bytes, little endian (1 .. 65535)
+ *   (extra match length bytes, if the low nibble is 15)
+ *
+ * Each "extra" length is a run of 255 bytes, ended by a smaller byte,
+ * all of which are added to the length.  The last sequence has only
+ * literals, and no offset.
+ *
+ * The packer is a greedy matcher with a single hash table entry per
+ * four byte string, so it is fast rather than tight.  It is good at the
+ * long runs and repeated rows found in the cave and wilderness maps.
+ */
+
+
+/*
+ * Size of the hash table (in bits)
+ */
+#define LZ_HASH_BITS	12
+
+/*
+ * Shortest useful match
+ */
+#define LZ_MIN_MATCH	4
+
+/*
+ * The last bytes of a block are always literals
+ */
+#define LZ_LAST_LITERALS	5
+
+/*
+ * Don't start a match this close to the end of the block
+ */
+#define LZ_MATCH_LIMIT	12
+
+/*
+ * Furthest back a match may point
+ */
+#define LZ_MAX_OFFSET	65535
+
+
+/*
+ * Read four bytes (in a byte-order independant way)
+ */
+static u32b lz_read32(const byte *p)
+{
+	return ((u32b)p[0] | ((u32b)p[1] << 8) |
+			((u32b)p[2] << 16) | ((u32b)p[3] << 24));
+}
+
+
+/*
+ * Hash four bytes into a table index
+ */
+static int lz_hash(u32b v)
+{
+	return (int)(((v * 2654435761UL) & 0xFFFFFFFFUL) >> (32 - LZ_HASH_BITS));
+}
+
+
+/*
+ * Write an "extra" length
+ */
+static u32b lz_put_len(byte *dst, u32b op, u32b n)
+{
+	while (n >= 255)
+	{
+		dst[op++] = 255;
+		n -= 255;
+	}
+
+	dst[op++] = (byte)n;
+
+	return (op);
+}
+
+
+/*
+ * Write a sequence.  A zero "mlen" marks the final literal run.
+ */
+static u32b lz_put_seq(byte *dst, u32b op, const byte *lit, u32b llen,
+                       u32b offset, u32b mlen)
+{
+	byte *token = &dst[op++];
+	u32b i;
+
+	/* Literal count */
+	if (llen >= 15)
+	{
+		*token = (15 << 4);
+		op = lz_put_len(dst, op, llen - 15);
+	}
+	else
+	{
+		*token = (byte)(llen << 4);
+	}
+
+	/* Literals */
+	for (i = 0; i < llen; i++) dst[op++] = lit[i];
+
+	/* Last run */
+	if (!mlen) return (op);
+
+	/* Offset */
+	dst[op++] = (byte)(offset & 0xFF);
+	dst[op++] = (byte)(offset >> 8);
+
+	/* Match length */
+	mlen -= LZ_MIN_MATCH;
+
+	if (mlen >= 15)
+	{
+		*token |= 15;
+		op = lz_put_len(dst, op, mlen - 15);
+	}
+	else
+	{
+		*token |= (byte)mlen;
+	}
+
+	return (op);
+}
+
+
+/*
+ * Pack "len" bytes from "src" into "dst".
+ *
+ * "dst" must have room for lz_bound(len) bytes.
+ *
+ * Returns the packed size.
+ */
+u32b lz_pack(const byte *src, u32b len, byte *dst)
+{
+	u32b table[1 << LZ_HASH_BITS];
+
+	u32b ip = 0, op = 0, anchor = 0;
+	u32b limit, mlimit;
+
+	/* Empty the hash table (entries are position + 1) */
+	(void)memset(table, 0, sizeof(table));
+
+	/* Only look for matches in large enough blocks */
+	if (len > LZ_MATCH_LIMIT)
+	{
+		limit = len - LZ_MATCH_LIMIT;
+		mlimit = len - LZ_LAST_LITERALS;
+
+		while (ip < limit)
+		{
+			u32b seq = lz_read32(&src[ip]);
+			int h = lz_hash(seq);
+			u32b ref = table[h];
+			u32b mlen;
+
+			/* Remember this position */
+			table[h] = ip + 1;
+
+			/* No match */
+			if (!ref || (ip - (ref - 1) > LZ_MAX_OFFSET) ||
+				(lz_read32(&src[ref - 1]) != seq))
+			{
+				ip++;
+				continue;
+			}
+
+			ref--;
+
+			/* Extend the match */
+			mlen = LZ_MIN_MATCH;
+			while ((ip + mlen < mlimit) && (src[ref + mlen] == src[ip + mlen]))
+			{
+				mlen++;
+			}
+
+			/* Dump the sequence */
+			op = lz_put_seq(dst, op, &src[anchor], ip - anchor, ip - ref, mlen);
+
+			/* Skip the matched data */
+			ip += mlen;
+			anchor = ip;
+		}
+	}
+
+	/* Dump the trailing literals */
+	op = lz_put_seq(dst, op, &src[anchor], len - anchor, 0, 0);
+
+	return (op);
+}
+
+
+/*
+ * Read an "extra" length, returning FALSE on overrun
+ */
+static bool lz_get_len(const byte *src, u32b src_len, u32b *ip, u32b *n)
+{
+	byte b;
+
+	do
+	{
+		if (*ip >= src_len) return (FALSE);
+
+		b = src[(*ip)++];
+		*n += b;
+	}
+	while (b == 255);
+
+	return (TRUE);
+}
+
+
+/*
+ * Unpack "src_len" bytes from "src" into exactly "len" bytes in "dst".
+ *
+ * Returns 0 on success, or -1 if the data is corrupt.
+ */
+errr lz_unpack(const byte *src, u32b src_len, byte *dst, u32b len)
+{
+	u32b ip = 0, op = 0;
+
+	while (ip < src_len)
+	{
+		byte token = src[ip++];
+		u32b n = token >> 4;
+		u32b offset;
+
+		/* Literals */
+		if ((n == 15) && !lz_get_len(src, src_len, &ip, &n)) return (-1);
+
+		if ((n > src_len - ip) || (n > len - op)) return (-1);
+
+		(void)memcpy(&dst[op], &src[ip], n);
+		ip += n;
+		op += n;
+
+		/* The last sequence has no match */
+		if (ip == src_len) break;
+
+		/* Offset */
+		if (src_len - ip < 2) return (-1);
+
+		offset = src[ip] | ((u32b)src[ip + 1] << 8);
+		ip += 2;
+
+		if (!offset || (offset > op)) return (-1);
+
+		/* Match length */
+		n = token & 15;
+
+		if ((n == 15) && !lz_get_len(src, src_len, &ip, &n)) return (-1);
+
+		n += LZ_MIN_MATCH;
+
+		if (n > len - op) return (-1);
+
+		/* Copy (the areas may overlap, to make runs) */
+		while (n--)
+		{
+			dst[op] = dst[op - offset];
+			op++;
+		}
+	}
+
+	/* Must fill the block exactly */
+	return ((op == len) ? 0 : -1);
+}
@@ -0,0 +1,40 @@
+/* File: z-pack.h */
+
+/*
+ * Copyright (c) The Zangband DevTeam
+ *
+ * This software may be copied and distributed for educational, research,
+ * and not for profit purposes provided that this copyright and statement
+ * are included in all such copies.  Other copyrights may also apply.
+ */
+
+#ifndef INCLUDED_Z_PACK_H
+#define INCLUDED_Z_PACK_H
+
+#include "h-basic.h"
+
+/*
+ * A small and fast LZ77 style compressor.
+ *
+ * The packed data uses the "LZ4 block" layout, so it can be checked
+ * with external tools, but only the subset needed by the game is
+ * supported (whole blocks, no frames or checksums).
+ */
+
+
+/**** Available macros ****/
+
+/*
+ * The largest size a block of "N" bytes can grow to when packed.
+ */
+#define lz_bound(N) \
+	((N) + ((N) / 255) + 16)
+
+
+/**** Available Functions ****/
+
+extern u32b lz_pack(const byte *src, u32b len, byte *dst);
+extern errr lz_unpack(const byte *src, u32b src_len, byte *dst, u32b len);
+
+
+#endif /* INCLUDED_Z_PACK_H */
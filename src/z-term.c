@@ -184,6 +184,7 @@
  *   Term->wipe_hook = Draw some blank spaces
  *   Term->text_hook = Draw some text in the window
  *   Term->pict_hook = Draw some attr/chars in the window
+ *   Term->draw_hook = Draw a list of changed spans (optional)
  *
  * The "Term->user_hook" hook provides a simple hook to an implementation
  * defined function, with application defined semantics.  It is available
@@ -225,6 +226,17 @@
  * "ap" and an array of chars "cp".  Old implementations of this hook
  * should now iterate over all "n" attr/char pairs.
  *
+ * The "Term->draw_hook" hook lets a port see all the changes made by a
+ * refresh at once.  If it is set, then instead of calling the "wipe",
+ * "text" and "pict" hooks for each stripe of grids, "Term_fresh()"
+ * collects the stripes in a list of "term_span" structures, and passes
+ * the whole list (or as much of it as fits in the buffer) to this hook,
+ * which can then draw it with a few batched requests.  The spans never
+ * overlap, so they can be drawn in any order.  Each span points into
+ * the requested screen image, and is only valid during the call.  The
+ * "TERM_XTRA_FROSH" action is not used by terms with this hook.  The
+ * other three hooks are still needed, for the software cursor.
+ *
  *
  * The game "Angband" uses a set of files called "main-xxx.c", for
  * various "xxx" suffixes.  Most of these contain a function called
@@ -660,9 +672,468 @@ void Term_queue_line(int x, int y, int n, byte *a, char *c, byte *ta, char *tc)
 }
 
 
+/*** Recording routines ***/
+
+
+/*
+ * A recording is a header ("ZTR", a version byte, and the width and
+ * height of the term), followed by one "frame" for each refresh that
+ * changed something:
+ *
+ *   'F', flags (see TERM_REC_*), cursor x, cursor y
+ *   for each modified row:
+ *     y, x, n, row flags
+ *     n attrs, n chars
+ *     n terrain attrs, n terrain chars (if the row flags have 0x01)
+ *   0xFF
+ *
+ * The modified rows are taken straight from the "change area" that
+ * "Term_fresh()" is about to draw, so a recording is small, and
+ * replaying it asks a term to do exactly the same work again.
+ */
+#define TERM_REC_ERASE	0x01	/* The frame was a "total erase" */
+#define TERM_REC_CU		0x02	/* The cursor is useless */
+#define TERM_REC_CV		0x04	/* The cursor is visible */
+
+#define TERM_REC_TERRAIN	0x01	/* The row has its own terrain layer */
+
+
+/*
+ * The file (and term) being recorded
+ */
+static FILE *term_rec_file = NULL;
+static term *term_rec_term = NULL;
+
+
+/*
+ * Write the changes about to be drawn by "Term_fresh()"
+ */
+static void Term_record_frame(void)
+{
+	term_win *scr = Term->scr;
+
+	FILE *fff = term_rec_file;
+
+	int x, y, n;
+
+	byte flags = 0;
+
+	if (Term->total_erase) flags |= TERM_REC_ERASE;
+	if (scr->cu) flags |= TERM_REC_CU;
+	if (scr->cv) flags |= TERM_REC_CV;
+
+	/* Frame header */
+	(void)putc('F', fff);
+	(void)putc(flags, fff);
+	(void)putc(scr->cx, fff);
+	(void)putc(scr->cy, fff);
+
+	/* Scan the "modified" rows */
+	for (y = Term->y1; y <= Term->y2; y++)
+	{
+		byte rflags = 0;
+
+		x = Term->x1[y];
+		n = Term->x2[y] - x + 1;
+
+		/* Unmodified row */
+		if (n <= 0) continue;
+
+		/* Does the terrain layer differ? */
+		if (memcmp(&scr->a[y][x], &scr->ta[y][x], n) ||
+			memcmp(&scr->c[y][x], &scr->tc[y][x], n))
+		{
+			rflags |= TERM_REC_TERRAIN;
+		}
+
+		(void)putc(y, fff);
+		(void)putc(x, fff);
+		(void)putc(n, fff);
+		(void)putc(rflags, fff);
+
+		(void)fwrite(&scr->a[y][x], 1, n, fff);
+		(void)fwrite(&scr->c[y][x], 1, n, fff);
+
+		if (rflags & TERM_REC_TERRAIN)
+		{
+			(void)fwrite(&scr->ta[y][x], 1, n, fff);
+			(void)fwrite(&scr->tc[y][x], 1, n, fff);
+		}
+	}
+
+	/* End of frame */
+	(void)putc(0xFF, fff);
+}
+
+
+/*
+ * Start recording the current term to the given (binary) file,
+ * or stop recording if the file is NULL.
+ *
+ * The file is not closed when the recording stops.
+ */
+errr Term_record(FILE *fff)
+{
+	/* Stop */
+	if (!fff)
+	{
+		term_rec_file = NULL;
+		term_rec_term = NULL;
+
+		return (0);
+	}
+
+	/* Header */
+	(void)fputs("ZTR", fff);
+	(void)putc(1, fff);
+	(void)putc(Term->wid, fff);
+	(void)putc(Term->hgt, fff);
+
+	term_rec_file = fff;
+	term_rec_term = Term;
+
+	/* Hack -- the first frame holds the whole screen */
+	Term->total_erase = TRUE;
+
+	/* Success */
+	return (0);
+}
+
+
+/*
+ * Feed a recording through the current term, as fast as possible.
+ *
+ * Rows which do not fit in the term are clipped.  The number of
+ * frames played is added to "frames".
+ *
+ * Returns -1 if the recording is corrupt.
+ */
+errr Term_replay(FILE *fff, int *frames)
+{
+	term_win *scr = Term->scr;
+
+	byte a[256], ta[256];
+	char c[256], tc[256];
+
+	char head[4];
+
+	int k, y, x, n, flags, rflags, cx, cy;
+
+	/* Don't record the replay */
+	FILE *rec = term_rec_file;
+	term_rec_file = NULL;
+
+	/* Check the header (the size of the term is ignored) */
+	if ((fread(head, 1, 4, fff) != 4) || strncmp(head, "ZTR", 3) ||
+		(head[3] != 1) || (getc(fff) == EOF) || (getc(fff) == EOF))
+	{
+		term_rec_file = rec;
+		return (-1);
+	}
+
+	/* Play each frame */
+	while ((k = getc(fff)) != EOF)
+	{
+		flags = getc(fff);
+		cx = getc(fff);
+		cy = getc(fff);
+
+		if ((k != 'F') || (cy == EOF)) break;
+
+		/* Queue the modified rows */
+		while ((y = getc(fff)) != 0xFF)
+		{
+			x = getc(fff);
+			n = getc(fff);
+			rflags = getc(fff);
+
+			if ((y == EOF) || (rflags == EOF) || (n == 0)) break;
+
+			if ((fread(a, 1, n, fff) != (size_t)n) ||
+				(fread(c, 1, n, fff) != (size_t)n)) break;
+
+			if (rflags & TERM_REC_TERRAIN)
+			{
+				if ((fread(ta, 1, n, fff) != (size_t)n) ||
+					(fread(tc, 1, n, fff) != (size_t)n)) break;
+			}
+			else
+			{
+				(void)memcpy(ta, a, n);
+				(void)memcpy(tc, c, n);
+			}
+
+			/* Clip to the term */
+			if ((y >= Term->hgt) || (x >= Term->wid)) continue;
+			if (x + n > Term->wid) n = Term->wid - x;
+
+			Term_queue_line(x, y, n, a, c, ta, tc);
+		}
+
+		/* Corrupt row */
+		if (y != 0xFF) break;
+
+		/* Hack -- force a full redraw */
+		if (flags & TERM_REC_ERASE) Term->total_erase = TRUE;
+
+		/* Place the cursor */
+		scr->cu = (flags & TERM_REC_CU) ? 1 : 0;
+		scr->cv = (flags & TERM_REC_CV) ? 1 : 0;
+
+		if ((cx < Term->wid) && (cy < Term->hgt))
+		{
+			scr->cx = cx;
+			scr->cy = cy;
+		}
+		else
+		{
+			scr->cu = 1;
+		}
+
+		/* Draw it */
+		Term_fresh();
+
+		(*frames)++;
+	}
+
+	term_rec_file = rec;
+
+	/* Stopped in the middle of a frame */
+	if (k != EOF) return (-1);
+
+	/* Success */
+	return (0);
+}
+
+
+
 /*** Refresh routines ***/
 
 
+/*
+ * Size of the span buffer for the "draw_hook"
+ */
+#define TERM_SPAN_MAX	256
+
+/*
+ * The spans waiting for the "draw_hook"
+ */
+static term_span term_spans[TERM_SPAN_MAX];
+static int term_span_num = 0;
+
+
+/*
+ * Send the pending spans to the "draw_hook"
+ */
+static void Term_fresh_batch(void)
+{
+	/* Nothing to do */
+	if (!term_span_num) return;
+
+	/* Draw them */
+	(void)((*Term->draw_hook) (term_span_num, term_spans));
+
+	/* Forget them */
+	term_span_num = 0;
+}
+
+
+/*
+ * Get a new span for the "draw_hook"
+ */
+static term_span *Term_fresh_span(int kind, int x, int y, int n)
+{
+	term_span *sp;
+
+	/* Make room */
+	if (term_span_num == TERM_SPAN_MAX) Term_fresh_batch();
+
+	sp = &term_spans[term_span_num++];
+
+	sp->kind = kind;
+	sp->a = 0;
+	sp->x = x;
+	sp->y = y;
+	sp->n = n;
+
+	/* The grids in the requested screen image */
+	sp->ap = &Term->scr->a[y][x];
+	sp->cp = &Term->scr->c[y][x];
+	sp->tap = &Term->scr->ta[y][x];
+	sp->tcp = &Term->scr->tc[y][x];
+
+	return (sp);
+}
+
+
+/*
+ * Erase some grids (see "Term_fresh")
+ */
+static void Term_fresh_wipe(int x, int y, int n)
+{
+	/* Batch it */
+	if (Term->draw_hook)
+	{
+		(void)Term_fresh_span(TERM_SPAN_WIPE, x, y, n);
+		return;
+	}
+
+	(void)((*Term->wipe_hook) (x, y, n));
+}
+
+
+/*
+ * Draw some text from the requested screen image (see "Term_fresh")
+ */
+static void Term_fresh_text(int x, int y, int n, byte a)
+{
+	/* Batch it */
+	if (Term->draw_hook)
+	{
+		Term_fresh_span(TERM_SPAN_TEXT, x, y, n)->a = a;
+		return;
+	}
+
+	(void)((*Term->text_hook) (x, y, n, a, &Term->scr->c[y][x]));
+}
+
+
+/*
+ * Draw some attr/char pairs from the requested screen image
+ * (see "Term_fresh")
+ */
+static void Term_fresh_pict(int x, int y, int n)
+{
+	term_win *scr = Term->scr;
+
+	/* Batch it */
+	if (Term->draw_hook)
+	{
+		(void)Term_fresh_span(TERM_SPAN_PICT, x, y, n);
+		return;
+	}
+
+	(void)((*Term->pict_hook) (x, y, n, &scr->a[y][x], &scr->c[y][x],
+							   &scr->ta[y][x], &scr->tc[y][x]));
+}
+
+
+/*
+ * Number of grids compared at once when looking for changes
+ */
+#define TERM_DIFF_BLOCK	16
+
+
+/*
+ * Find the first grid in x1..x2 where two rows differ.
+ *
+ * Whole blocks are compared with a fixed size "memcmp()", which the
+ * compiler (or the C library) turns into a few word sized compares,
+ * so long runs of unchanged grids are skipped quickly.
+ *
+ * Returns x2 + 1 if the rows are the same.
+ */
+static int Term_diff_head(const char *s1, const char *s2, int x1, int x2)
+{
+	/* Skip unchanged blocks */
+	while ((x2 - x1 >= TERM_DIFF_BLOCK - 1) &&
+		   !memcmp(s1 + x1, s2 + x1, TERM_DIFF_BLOCK))
+	{
+		x1 += TERM_DIFF_BLOCK;
+	}
+
+	/* Find the exact grid */
+	while ((x1 <= x2) && (s1[x1] == s2[x1])) x1++;
+
+	return (x1);
+}
+
+
+/*
+ * Find the last grid in x1..x2 where two rows differ.
+ *
+ * Returns x1 - 1 if the rows are the same.
+ */
+static int Term_diff_tail(const char *s1, const char *s2, int x1, int x2)
+{
+	/* Skip unchanged blocks */
+	while ((x2 - x1 >= TERM_DIFF_BLOCK - 1) &&
+		   !memcmp(s1 + x2 - (TERM_DIFF_BLOCK - 1),
+				   s2 + x2 - (TERM_DIFF_BLOCK - 1), TERM_DIFF_BLOCK))
+	{
+		x2 -= TERM_DIFF_BLOCK;
+	}
+
+	/* Find the exact grid */
+	while ((x2 >= x1) && (s1[x2] == s2[x2])) x2--;
+
+	return (x2);
+}
+
+
+/*
+ * Shrink the "modified" columns of a row to the grids that have
+ * really changed.  (The terrain layer is only checked if it is used.)
+ *
+ * Grids often get changed and then changed back before the next
+ * refresh (think of a bolt going past), so this avoids scanning
+ * one grid at a time over lots of unchanged grids in the helpers
+ * below, or even bothering with the row at all.
+ *
+ * Returns FALSE if nothing in the row has changed.
+ */
+static bool Term_fresh_trim(int y, int *x1, int *x2, bool terrain)
+{
+	term_win *old = Term->old;
+	term_win *scr = Term->scr;
+
+	int lo = *x2 + 1, hi = *x1 - 1, x;
+
+	/* Find the first change */
+	x = Term_diff_head((char *)old->a[y], (char *)scr->a[y], *x1, *x2);
+	if (x < lo) lo = x;
+
+	x = Term_diff_head(old->c[y], scr->c[y], *x1, lo - 1);
+	if (x < lo) lo = x;
+
+	if (terrain)
+	{
+		x = Term_diff_head((char *)old->ta[y], (char *)scr->ta[y], *x1,
+						   lo - 1);
+		if (x < lo) lo = x;
+
+		x = Term_diff_head(old->tc[y], scr->tc[y], *x1, lo - 1);
+		if (x < lo) lo = x;
+	}
+
+	/* Nothing changed */
+	if (lo > *x2) return (FALSE);
+
+	/* Find the last change */
+	x = Term_diff_tail((char *)old->a[y], (char *)scr->a[y], lo, *x2);
+	if (x > hi) hi = x;
+
+	x = Term_diff_tail(old->c[y], scr->c[y], hi + 1, *x2);
+	if (x > hi) hi = x;
+
+	if (terrain)
+	{
+		x = Term_diff_tail((char *)old->ta[y], (char *)scr->ta[y], hi + 1,
+						   *x2);
+		if (x > hi) hi = x;
+
+		x = Term_diff_tail(old->tc[y], scr->tc[y], hi + 1, *x2);
+		if (x > hi) hi = x;
+	}
+
+	/* Save the changed columns */
+	*x1 = lo;
+	*x2 = hi;
+
+	return (TRUE);
+}
+
+
 /*
  * Flush a row of the current window (see "Term_fresh")
  *
@@ -727,9 +1198,7 @@ static void Term_fresh_row_pict(int y, int x1, int x2)
 			if (fn)
 			{
 				/* Draw pending attr/char pairs */
-				(void)((*Term->pict_hook) (fx, y, fn,
-										   &scr_aa[fx], &scr_cc[fx],
-										   &scr_taa[fx], &scr_tcc[fx]));
+				Term_fresh_pict(fx, y, fn);
 
 				/* Forget */
 				fn = 0;
@@ -753,9 +1222,7 @@ static void Term_fresh_row_pict(int y, int x1, int x2)
 	if (fn)
 	{
 		/* Draw pending attr/char pairs */
-		(void)((*Term->pict_hook) (fx, y, fn,
-								   &scr_aa[fx], &scr_cc[fx], &scr_taa[fx],
-								   &scr_tcc[fx]));
+		Term_fresh_pict(fx, y, fn);
 	}
 }
 
@@ -832,12 +1299,12 @@ static void Term_fresh_row_both(int y, int x1, int x2)
 				/* Draw pending chars (normal) */
 				if (fa || always_text)
 				{
-					(void)((*Term->text_hook) (fx, y, fn, fa, &scr_cc[fx]));
+					Term_fresh_text(fx, y, fn, fa);
 				}
 				/* Draw pending chars (black) */
 				else
 				{
-					(void)((*Term->wipe_hook) (fx, y, fn));
+					Term_fresh_wipe(fx, y, fn);
 				}
 				/* Forget */
 				fn = 0;
@@ -863,19 +1330,19 @@ static void Term_fresh_row_both(int y, int x1, int x2)
 				/* Draw pending chars (normal) */
 				if (fa || always_text)
 				{
-					(void)((*Term->text_hook) (fx, y, fn, fa, &scr_cc[fx]));
+					Term_fresh_text(fx, y, fn, fa);
 				}
 				/* Draw pending chars (black) */
 				else
 				{
-					(void)((*Term->wipe_hook) (fx, y, fn));
+					Term_fresh_wipe(fx, y, fn);
 				}
 				/* Forget */
 				fn = 0;
 			}
 
 			/* Hack -- Draw the special attr/char pair */
-			(void)((*Term->pict_hook) (x, y, 1, &na, &nc, &nta, &ntc));
+			Term_fresh_pict(x, y, 1);
 
 			/* Skip */
 			continue;
@@ -890,12 +1357,12 @@ static void Term_fresh_row_both(int y, int x1, int x2)
 				/* Draw the pending chars */
 				if (fa || always_text)
 				{
-					(void)((*Term->text_hook) (fx, y, fn, fa, &scr_cc[fx]));
+					Term_fresh_text(fx, y, fn, fa);
 				}
 				/* Hack -- Erase "leading" spaces */
 				else
 				{
-					(void)((*Term->wipe_hook) (fx, y, fn));
+					Term_fresh_wipe(fx, y, fn);
 				}
 				/* Forget */
 				fn = 0;
@@ -915,12 +1382,12 @@ static void Term_fresh_row_both(int y, int x1, int x2)
 		/* Draw pending chars (normal) */
 		if (fa || always_text)
 		{
-			(void)((*Term->text_hook) (fx, y, fn, fa, &scr_cc[fx]));
+			Term_fresh_text(fx, y, fn, fa);
 		}
 		/* Draw pending chars (black) */
 		else
 		{
-			(void)((*Term->wipe_hook) (fx, y, fn));
+			Term_fresh_wipe(fx, y, fn);
 		}
 	}
 }
@@ -980,13 +1447,13 @@ static void Term_fresh_row_text(int y, int x1, int x2)
 				/* Draw pending chars (normal) */
 				if (fa || always_text)
 				{
-					(void)((*Term->text_hook) (fx, y, fn, fa, &scr_cc[fx]));
+					Term_fresh_text(fx, y, fn, fa);
 				}
 
 				/* Draw pending chars (black) */
 				else
 				{
-					(void)((*Term->wipe_hook) (fx, y, fn));
+					Term_fresh_wipe(fx, y, fn);
 				}
 
 				/* Forget */
@@ -1010,13 +1477,13 @@ static void Term_fresh_row_text(int y, int x1, int x2)
 				/* Draw the pending chars */
 				if (fa || always_text)
 				{
-					(void)((*Term->text_hook) (fx, y, fn, fa, &scr_cc[fx]));
+					Term_fresh_text(fx, y, fn, fa);
 				}
 
 				/* Hack -- Erase "leading" spaces */
 				else
 				{
-					(void)((*Term->wipe_hook) (fx, y, fn));
+					Term_fresh_wipe(fx, y, fn);
 				}
 
 				/* Forget */
@@ -1037,13 +1504,13 @@ static void Term_fresh_row_text(int y, int x1, int x2)
 		/* Draw pending chars (normal) */
 		if (fa || always_text)
 		{
-			(void)((*Term->text_hook) (fx, y, fn, fa, &scr_cc[fx]));
+			Term_fresh_text(fx, y, fn, fa);
 		}
 
 		/* Draw pending chars (black) */
 		else
 		{
-			(void)((*Term->wipe_hook) (fx, y, fn));
+			Term_fresh_wipe(fx, y, fn);
 		}
 	}
 }
@@ -1086,6 +1553,18 @@ static void Term_fresh_section(void)
 			int x1 = Term->x1[y];
 			int x2 = Term->x2[y];
 
+			/* Skip rows that have been changed back */
+			if ((x1 <= x2) && !Term->total_erase &&
+				!Term_fresh_trim(y, &x1, &x2,
+								 (Term->always_pict || Term->higher_pict)))
+			{
+				/* This row is all done */
+				Term->x1[y] = w;
+				Term->x2[y] = 0;
+
+				continue;
+			}
+
 			/* Flush each "modified" row */
 			if (x1 <= x2)
 			{
@@ -1115,7 +1594,10 @@ static void Term_fresh_section(void)
 				Term->x2[y] = 0;
 
 				/* Hack -- Flush that row (if allowed) */
-				if (!Term->never_frosh) Term_xtra(TERM_XTRA_FROSH, y);
+				if (!Term->never_frosh && !Term->draw_hook)
+				{
+					Term_xtra(TERM_XTRA_FROSH, y);
+				}
 			}
 		}
 
@@ -1347,6 +1829,9 @@ void Term_fresh(void)
 		}
 	}
 
+	/* Record the changes */
+	if (term_rec_file && (Term == term_rec_term)) Term_record_frame();
+
 
 	/* Cursor update -- Erase old Cursor */
 	if (Term->soft_cursor)
@@ -1409,6 +1894,9 @@ void Term_fresh(void)
 	/* Redraw stuff as required */
 	Term_fresh_section();
 
+	/* Draw any batched spans */
+	Term_fresh_batch();
+
 	/* Redraw cursor */
 	Term_fresh_cursor();
 
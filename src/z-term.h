@@ -61,6 +61,38 @@ struct term_win
 };
 
 
+/*
+ * A term_span is a stripe of changed grids in one row, which is
+ * passed to the "draw_hook" of a term (see "Term_fresh()")
+ *
+ *	- Kind of span (see TERM_SPAN_*)
+ *	- Attribute (for text spans)
+ *
+ *	- Location of the first grid
+ *	- Number of grids
+ *
+ *	- The attr/chars of the grids
+ *	- The terrain attr/chars of the grids
+ */
+
+typedef struct term_span term_span;
+
+struct term_span
+{
+	byte kind;
+	byte a;
+
+	byte x, y;
+	int n;
+
+	const byte *ap;
+	const char *cp;
+
+	const byte *tap;
+	const char *tcp;
+};
+
+
 
 /*
  * An actual "term" structure
@@ -157,6 +189,8 @@ struct term_win
  *	- Hook for drawing a string of chars using an attr
  *
  *	- Hook for drawing a sequence of special attr/char pairs
+ *
+ *	- Hook for drawing a list of changed spans (optional)
  */
 
 typedef struct term term;
@@ -223,6 +257,8 @@ struct term
 
 	errr (*pict_hook) (int x, int y, int n, const byte *ap, const char *cp,
 					   const byte *tap, const char *tcp);
+
+	errr (*draw_hook) (int n, const term_span *sp);
 };
 
 
@@ -263,6 +299,14 @@ struct term
 #define TERM_XTRA_DELAY 13		/* Delay some milliseconds (optional) */
 
 
+/*
+ * Kinds of "term_span" (see "Term_fresh()")
+ */
+#define TERM_SPAN_WIPE	0		/* Erase the grids */
+#define TERM_SPAN_TEXT	1		/* Draw the chars using the attr "a" */
+#define TERM_SPAN_PICT	2		/* Draw the attr/char pairs */
+
+
 
 
 /**** Available Variables ****/
@@ -313,4 +357,7 @@ extern errr term_init(term *t, int w, int h, int k);
 
 extern errr Term_bigregion(int x1, int y1, int y2);
 
+extern errr Term_record(FILE *fff);
+extern errr Term_replay(FILE *fff, int *frames);
+
 #endif /* INCLUDED_Z_TERM_H */
@@ -69,6 +69,13 @@ vptr rpanic(huge len)
 vptr (*ralloc_aux) (huge) = NULL;
 
 
+/*
+ * Number of calls to "ralloc()", and the bytes asked for
+ */
+u32b ralloc_count = 0;
+huge ralloc_total = 0;
+
+
 /*
  * Allocate some memory
  */
@@ -79,6 +86,10 @@ vptr ralloc(huge len)
 	/* Allow allocation of "zero bytes" */
 	if (len == 0) return ((vptr)(NULL));
 
+	/* Count it */
+	ralloc_count++;
+	ralloc_total += len;
+
 	/* Use the aux function if set */
 	if (ralloc_aux) mem = (*ralloc_aux) (len);
 
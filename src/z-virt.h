@@ -139,6 +139,10 @@ extern vptr (*rpanic_aux) (huge);
 /* Replacement hook for "ralloc()" */
 extern vptr (*ralloc_aux) (huge);
 
+/* Number of calls to "ralloc()", and the bytes asked for */
+extern u32b ralloc_count;
+extern huge ralloc_total;
+
 
 /**** Available functions ****/
 